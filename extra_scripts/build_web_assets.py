@@ -0,0 +1,132 @@
+import base64
+import gzip
+import hashlib
+import os
+import re
+import shutil
+
+# Web-UI-Assets bauen:
+# - web/index.html, web/app.css, web/app.js (+ Icon aus docs/icons) minifizieren
+# - data/ (LittleFS-Image, `pio run -t buildfs`): index.html.gz + fingerprinted
+#   /assets/<name>.<hash>.<ext>.gz (immutable cachebar)
+# - include/web_ui.h: alles inline als Fallback, falls das Dateisystem fehlt
+#   oder nicht zur Firmware passt (OTA aktualisiert nur die App-Partition)
+
+WEB_DIR = "web"
+DATA_DIR = "data"
+HEADER = os.path.join("include", "web_ui.h")
+
+# Logischer Name in index.html → Quelldatei
+ASSETS = {
+    "app.css": os.path.join(WEB_DIR, "app.css"),
+    "app.js": os.path.join(WEB_DIR, "app.js"),
+    "icon.svg": os.path.join("docs", "icons", "icon.svg"),
+}
+
+
+def read(path):
+    with open(path, "r", encoding="utf-8") as f:
+        return f.read()
+
+
+def minify_css(css):
+    css = re.sub(r"/\*.*?\*/", "", css, flags=re.S)
+    css = re.sub(r"\s+", " ", css)
+    css = re.sub(r"\s*([{}:;,>])\s*", r"\1", css)
+    return css.replace(";}", "}").strip()
+
+
+def minify_js(js):
+    # Konservativ: Einrückung, Leerzeilen und reine Kommentarzeilen entfernen,
+    # Zeilenumbrüche bleiben (ASI, Template-Strings)
+    out = []
+    for line in js.splitlines():
+        line = line.strip()
+        if line and not line.startswith("//"):
+            out.append(line)
+    return "\n".join(out)
+
+
+def minify_html(html):
+    html = re.sub(r"<!--.*?-->", "", html, flags=re.S)
+    return "\n".join(line.strip() for line in html.splitlines() if line.strip())
+
+
+def minify(name, text):
+    if name.endswith(".css"):
+        return minify_css(text)
+    if name.endswith(".js"):
+        return minify_js(text)
+    if name.endswith(".html"):
+        return minify_html(text)
+    return text.strip()
+
+
+def gz(data):
+    # mtime=0 → gleiche Eingabe ergibt gleiche Bytes (stabiler ETag)
+    return gzip.compress(data, compresslevel=9, mtime=0)
+
+
+def short_hash(data):
+    return hashlib.sha256(data).hexdigest()[:16]
+
+
+html_src = read(os.path.join(WEB_DIR, "index.html"))
+assets = {name: minify(name, read(path)).encode("utf-8") for name, path in ASSETS.items()}
+
+# --- LittleFS: fingerprinted Dateien ---------------------------------------
+shutil.rmtree(DATA_DIR, ignore_errors=True)
+os.makedirs(os.path.join(DATA_DIR, "assets"))
+
+fs_html = html_src
+raw_total = len(html_src.encode("utf-8"))
+fs_total = 0
+for name, data in assets.items():
+    raw_total += os.path.getsize(ASSETS[name])
+    base, ext = os.path.splitext(name)
+    fingerprinted = f"{base}.{short_hash(data)[:8]}{ext}"
+    fs_html = fs_html.replace(f'"{name}"', f'"/assets/{fingerprinted}"')
+    packed = gz(data)
+    fs_total += len(packed)
+    with open(os.path.join(DATA_DIR, "assets", fingerprinted + ".gz"), "wb") as f:
+        f.write(packed)
+
+fs_index = gz(minify_html(fs_html).encode("utf-8"))
+fs_total += len(fs_index)
+with open(os.path.join(DATA_DIR, "index.html.gz"), "wb") as f:
+    f.write(fs_index)
+
+# Kennung des Asset-Stands: Firmware nutzt das Dateisystem nur bei Gleichheit
+assets_id = short_hash(fs_index + b"".join(assets.values()))
+with open(os.path.join(DATA_DIR, "assets.id"), "w") as f:
+    f.write(assets_id)
+
+# --- Fallback: alles inline in einem gzip-Blob -----------------------------
+inline_html = html_src
+inline_html = inline_html.replace('<link rel="stylesheet" href="app.css">',
+                                  "<style>" + assets["app.css"].decode("utf-8") + "</style>")
+inline_html = inline_html.replace('<script src="app.js"></script>',
+                                  "<script>" + assets["app.js"].decode("utf-8") + "</script>")
+inline_html = inline_html.replace('href="icon.svg"', 'href="data:image/svg+xml;base64,' +
+                                  base64.b64encode(assets["icon.svg"]).decode("ascii") + '"')
+blob = gz(minify_html(inline_html).encode("utf-8"))
+etag = short_hash(blob)
+
+lines = []
+for i in range(0, len(blob), 16):
+    lines.append("    " + ", ".join(f"0x{b:02x}" for b in blob[i:i + 16]) + ",")
+
+os.makedirs("include", exist_ok=True)
+with open(HEADER, "w") as f:
+    f.write("#pragma once\n")
+    f.write("// Automatisch erzeugt von extra_scripts/build_web_assets.py – nicht bearbeiten!\n")
+    f.write("#include <Arduino.h>\n\n")
+    f.write(f'#define WEB_UI_ETAG "\\"{etag}\\""\n')
+    f.write(f'#define WEB_ASSETS_ID "{assets_id}"\n')
+    f.write(f"#define WEB_UI_GZ_LEN {len(blob)}\n\n")
+    f.write("static const uint8_t WEB_UI_GZ[] PROGMEM = {\n")
+    f.write("\n".join(lines) + "\n")
+    f.write("};\n")
+
+print(f"// 🌐 Web-UI: {raw_total} Bytes → LittleFS {fs_total} Bytes (gzip), "
+      f"inline {len(blob)} Bytes, Assets {assets_id}")
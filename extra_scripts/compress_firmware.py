@@ -0,0 +1,25 @@
+Import("env")
+import zlib
+
+# firmware.bin zusätzlich als firmware.bin.gz ablegen (für OTA über schwaches WLAN).
+# 4-KB-Fenster (wbits 12) → der ESP32 entpackt mit einem festen 4-KB-Ringpuffer.
+# Muss zu OTA_INFLATE_WINDOW in include/ota_service.h passen!
+WINDOW_BITS = 12
+
+
+def compress_firmware(source, target, env):
+    path = str(target[0])
+    with open(path, "rb") as f:
+        data = f.read()
+
+    # 16 + wbits → gzip-Container ohne Dateiname/mtime (reproduzierbar)
+    c = zlib.compressobj(9, zlib.DEFLATED, 16 + WINDOW_BITS)
+    gz = c.compress(data) + c.flush()
+
+    with open(path + ".gz", "wb") as f:
+        f.write(gz)
+
+    print(f"// 📦 Firmware: {len(data)} → {len(gz)} Bytes (gzip, {1 << WINDOW_BITS} B Fenster)")
+
+
+env.AddPostAction("$BUILD_DIR/${PROGNAME}.bin", compress_firmware)
@@ -0,0 +1,69 @@
+#!/usr/bin/env python3
+# DDP-Sender für den Drop-Test: schickt 1-bpp-Frames (32 Byte, PUSH) mit
+# fester Rate und vergleicht danach die Zähler des Geräts.
+#
+# Start:  python3 extra_scripts/ddp_sender.py <Geräte-IP> [--fps 60] [--seconds 30]
+#
+# Ziel bei 60 fps: jeder Frame kommt an (ddpFrames), keine Lücken in der
+# Sequenznummer (ddpDropped) und keiner wird vor der Anzeige überholt
+# (ddpSkipped). obegraensad_frames_skipped_total (/metrics) zählt die
+# Sekunden-Ticks, die der Stream der Uhr abnimmt – steigt also um ~1/s.
+
+import argparse
+import json
+import re
+import socket
+import time
+import urllib.request
+
+DDP_PORT = 4048
+
+
+def device(host, path):
+    with urllib.request.urlopen("http://%s%s" % (host, path), timeout=5) as r:
+        return r.read().decode("utf-8")
+
+
+def counters(host):
+    status = json.loads(device(host, "/api/status"))
+    ticks = sum(int(v) for v in re.findall(r"^obegraensad_frames_skipped_total\{[^}]*\} (\d+)$",
+                                           device(host, "/metrics"), re.M))
+    return status["ddpFrames"], status["ddpDropped"], status["ddpSkipped"], ticks
+
+
+def main():
+    parser = argparse.ArgumentParser(description="DDP-Sender (Drop-Test)")
+    parser.add_argument("host")
+    parser.add_argument("--fps", type=float, default=60)
+    parser.add_argument("--seconds", type=float, default=30)
+    args = parser.parse_args()
+
+    before = counters(args.host)
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    # Header: V1|PUSH, Sequenz 1..15, Typ 1 bpp, Quelle 1, Offset 0, Länge 32
+    header = bytes([0x41, 0, 0x01, 0x01, 0, 0, 0, 0, 0, 32])
+    interval = 1.0 / args.fps
+    start = time.perf_counter()
+    sent = 0
+    while time.perf_counter() - start < args.seconds:
+        # Laufender Balken: eine Spalte pro Frame
+        col = sent % 16
+        frame = bytes((0x80 >> (col & 7)) if (i & 1) == (col >> 3) else 0 for i in range(32))
+        pkt = bytearray(header)
+        pkt[1] = sent % 15 + 1
+        sock.sendto(bytes(pkt) + frame, (args.host, DDP_PORT))
+        sent += 1
+        time.sleep(max(0.0, start + sent * interval - time.perf_counter()))
+    elapsed = time.perf_counter() - start
+
+    time.sleep(0.5)
+    after = counters(args.host)
+    frames, dropped, skipped, ticks = (a - b for a, b in zip(after, before))
+    print("%d Frames in %.1f s gesendet (%.1f fps)" % (sent, elapsed, sent / elapsed))
+    print("Gerät: %d empfangen, %d verloren, %d überholt, %d Sekunden-Ticks ausgelassen"
+          % (frames, dropped, skipped, ticks))
+    raise SystemExit(0 if frames == sent and dropped == 0 and skipped == 0 else 1)
+
+
+if __name__ == "__main__":
+    main()
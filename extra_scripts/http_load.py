@@ -0,0 +1,112 @@
+#!/usr/bin/env python3
+# Lastgenerator für den Webserver: mehrere parallele Keep-Alive-Clients
+# fragen die API ab, gemessen werden p50/p99/max der Antwortzeit.
+#
+# Start:  python3 extra_scripts/http_load.py <Geräte-IP> [--clients 4] [--seconds 30]
+#
+# Neben der Client-Sicht (inkl. WLAN) stehen am Ende die auf dem Gerät
+# gemessenen Werte aus /api/status (httpP50Us/httpP99Us, nur Handlerzeit).
+
+import argparse
+import http.client
+import json
+import sys
+import threading
+import time
+
+PATHS = ["/api/status", "/api/settings", "/api/status", "/"]
+
+
+def percentile(values, p):
+    if not values:
+        return 0.0
+    values = sorted(values)
+    return values[min(len(values) - 1, int(len(values) * p / 100))]
+
+
+class Client(threading.Thread):
+    def __init__(self, host, port, deadline, rate):
+        super().__init__(daemon=True)
+        self.host, self.port = host, port
+        self.deadline = deadline
+        self.interval = 1.0 / rate if rate > 0 else 0.0
+        self.latencies = []
+        self.errors = 0
+        self.reconnects = 0
+
+    def run(self):
+        conn = None
+        i = 0
+        while time.time() < self.deadline:
+            if conn is None:
+                conn = http.client.HTTPConnection(self.host, self.port, timeout=5)
+                self.reconnects += 1
+            path = PATHS[i % len(PATHS)]
+            i += 1
+            started = time.perf_counter()
+            try:
+                # Gzip-Seite wie der Browser anfordern; Antwort vollständig lesen (Keep-Alive)
+                conn.request("GET", path, headers={"Accept-Encoding": "gzip", "Connection": "keep-alive"})
+                resp = conn.getresponse()
+                resp.read()
+                if resp.status >= 400:
+                    self.errors += 1
+                if resp.getheader("Connection", "").lower() == "close":
+                    conn.close()
+                    conn = None
+            except (OSError, http.client.HTTPException):
+                self.errors += 1
+                conn.close()
+                conn = None
+                continue
+            self.latencies.append((time.perf_counter() - started) * 1000.0)
+            if self.interval:
+                time.sleep(max(0.0, self.interval - (time.perf_counter() - started)))
+        if conn:
+            conn.close()
+
+
+def device_status(host, port):
+    conn = http.client.HTTPConnection(host, port, timeout=5)
+    conn.request("GET", "/api/status")
+    data = json.loads(conn.getresponse().read().decode("utf-8"))
+    conn.close()
+    return data
+
+
+def main():
+    parser = argparse.ArgumentParser(description="HTTP-Lastgenerator (p50/p99)")
+    parser.add_argument("host")
+    parser.add_argument("--port", type=int, default=80)
+    parser.add_argument("--clients", type=int, default=4, help="parallele Verbindungen")
+    parser.add_argument("--seconds", type=float, default=30)
+    parser.add_argument("--rate", type=float, default=0, help="Anfragen/s je Client (0 = so schnell wie möglich)")
+    args = parser.parse_args()
+
+    deadline = time.time() + args.seconds
+    clients = [Client(args.host, args.port, deadline, args.rate) for _ in range(args.clients)]
+    for c in clients:
+        c.start()
+    for c in clients:
+        c.join()
+
+    latencies = [l for c in clients for l in c.latencies]
+    errors = sum(c.errors for c in clients)
+    connects = sum(c.reconnects for c in clients)
+    if not latencies:
+        print("Keine erfolgreiche Anfrage (%d Fehler)" % errors)
+        sys.exit(1)
+
+    print("%d Anfragen in %.0f s (%.1f/s), %d Fehler, %d Verbindungen (%d Clients)"
+          % (len(latencies), args.seconds, len(latencies) / args.seconds, errors, connects, args.clients))
+    print("Client  p50 %.1f ms | p99 %.1f ms | max %.1f ms"
+          % (percentile(latencies, 50), percentile(latencies, 99), max(latencies)))
+
+    status = device_status(args.host, args.port)
+    print("Gerät   p50 %.2f ms | p99 %.2f ms (Handlerzeit, /api/status)"
+          % (status.get("httpP50Us", 0) / 1000.0, status.get("httpP99Us", 0) / 1000.0))
+    sys.exit(1 if errors else 0)
+
+
+if __name__ == "__main__":
+    main()
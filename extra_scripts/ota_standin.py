@@ -0,0 +1,171 @@
+#!/usr/bin/env python3
+# Lokaler Ersatz für die GitHub-Release (OTA-Test ohne Internet).
+#
+# Liefert version.txt, firmware.bin, firmware.bin.gz und firmware.bin.sha256
+# aus dem Build-Verzeichnis über HTTP/1.1 mit Keep-Alive. Fehlen .gz oder
+# .sha256, werden sie wie von compress_firmware.py bzw. sha256sum erzeugt.
+# Pro Antwort stehen übertragene Bytes und Dauer auf der Konsole.
+#
+# Gerät umbiegen (platformio.ini, build_flags):
+#   -D OTA_VERSION_URL=\"http://<PC-IP>:8090/releases/latest/download/version.txt\"
+#   -D OTA_FIRMWARE_URL=\"http://<PC-IP>:8090/releases/latest/download/firmware.bin\"
+#   -D OTA_FIRMWARE_GZ_URL=\"http://<PC-IP>:8090/releases/latest/download/firmware.bin.gz\"
+#   -D OTA_SHA256_URL=\"http://<PC-IP>:8090/releases/latest/download/firmware.bin.sha256\"
+# /releases/latest/download/<Datei> leitet wie GitHub per 302 auf /cdn/<Datei> um.
+#
+# Start:  python3 extra_scripts/ota_standin.py [--dir .pio/build/esp32dev] [--device <IP>]
+# Mit --device wird das Update über /api/update angestoßen und am Ende die
+# Sicht des Geräts (/api/update/status) neben die des Servers gestellt.
+
+import argparse
+import hashlib
+import json
+import os
+import sys
+import threading
+import time
+import urllib.request
+import zlib
+from http.server import BaseHTTPRequestHandler, ThreadingHTTPServer
+
+WINDOW_BITS = 12   # wie extra_scripts/compress_firmware.py / OTA_INFLATE_WINDOW
+REDIRECT_PREFIX = "/releases/latest/download/"
+CDN_PREFIX = "/cdn/"
+
+
+def load_release(build_dir, version, with_gz):
+    with open(os.path.join(build_dir, "firmware.bin"), "rb") as f:
+        image = f.read()
+    files = {
+        "version.txt": (version + "\n").encode(),
+        "firmware.bin": image,
+        "firmware.bin.sha256": ("%s  firmware.bin\n" % hashlib.sha256(image).hexdigest()).encode(),
+    }
+    if with_gz:
+        gz_path = os.path.join(build_dir, "firmware.bin.gz")
+        if os.path.exists(gz_path):
+            with open(gz_path, "rb") as f:
+                files["firmware.bin.gz"] = f.read()
+        else:
+            c = zlib.compressobj(9, zlib.DEFLATED, 16 + WINDOW_BITS)
+            files["firmware.bin.gz"] = c.compress(image) + c.flush()
+    return files
+
+
+class Stats:
+    def __init__(self):
+        self.lock = threading.Lock()
+        self.first = None
+        self.last = None
+        self.bytes = 0
+        self.requests = 0
+        self.connections = set()
+
+    def add(self, conn, started, sent):
+        with self.lock:
+            self.first = started if self.first is None else min(self.first, started)
+            self.last = time.perf_counter()
+            self.bytes += sent
+            self.requests += 1
+            self.connections.add(conn)
+
+
+stats = Stats()
+release = {}
+
+
+class Handler(BaseHTTPRequestHandler):
+    protocol_version = "HTTP/1.1"   # Keep-Alive wie bei GitHub/CDN
+
+    def do_GET(self):
+        started = time.perf_counter()
+        if self.path.startswith(REDIRECT_PREFIX):
+            self.send_response(302)
+            self.send_header("Location", "http://%s%s%s" % (self.headers["Host"], CDN_PREFIX,
+                                                           self.path[len(REDIRECT_PREFIX):]))
+            self.send_header("Content-Length", "0")
+            self.end_headers()
+            return
+        name = self.path[len(CDN_PREFIX):] if self.path.startswith(CDN_PREFIX) else self.path.lstrip("/")
+        body = release.get(name)
+        if body is None:
+            self.send_error(404)
+            return
+        self.send_response(200)
+        self.send_header("Content-Type", "application/octet-stream")
+        self.send_header("Content-Length", str(len(body)))
+        self.end_headers()
+        self.wfile.write(body)
+        stats.add(self.client_address, started, len(body))
+        print("  %-20s %8d Bytes %7.0f ms  (Verbindung %s:%d)"
+              % (name, len(body), (time.perf_counter() - started) * 1000, *self.client_address), flush=True)
+
+    def log_message(self, fmt, *args):
+        pass
+
+
+# ------------------------------------------------------
+# Update am Gerät anstoßen und Ergebnis abholen
+# ------------------------------------------------------
+def device_json(device, path, method="GET"):
+    req = urllib.request.Request("http://%s%s" % (device, path), method=method,
+                                 data=b"" if method == "POST" else None)
+    with urllib.request.urlopen(req, timeout=5) as r:
+        return json.loads(r.read().decode("utf-8") or "{}")
+
+
+def run_device(device):
+    device_json(device, "/api/update", "POST")
+    status = {}
+    deadline = time.time() + 300
+    while time.time() < deadline:
+        time.sleep(1)
+        try:
+            status = device_json(device, "/api/update/status")
+        except OSError:
+            break   # Gerät startet nach Erfolg neu
+        if status.get("state") in ("success", "failed", "uptodate"):
+            break
+    print("Gerät:  %s, %s Bytes übertragen (%s), Image %s Bytes, %s ms"
+          % (status.get("state", "?"), status.get("downloaded", "?"),
+             "gzip" if status.get("compressed") else "raw", status.get("imageBytes", "?"),
+             status.get("durationMs", "?")))
+    return status.get("state") == "success"
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Lokaler OTA-Server (GitHub-Release-Ersatz)")
+    parser.add_argument("--dir", default=".pio/build/esp32dev", help="Verzeichnis mit firmware.bin")
+    parser.add_argument("--port", type=int, default=8090)
+    parser.add_argument("--version", default="v-standin", help="Inhalt von version.txt")
+    parser.add_argument("--no-gz", action="store_true", help="firmware.bin.gz weglassen (Rückfallpfad)")
+    parser.add_argument("--device", help="IP des Geräts: Update anstoßen und auswerten")
+    args = parser.parse_args()
+
+    release.update(load_release(args.dir, args.version, not args.no_gz))
+    image = len(release["firmware.bin"])
+    gz = len(release.get("firmware.bin.gz", b""))
+    print("OTA-Ersatz auf Port %d: %s, firmware.bin %d Bytes%s" % (
+        args.port, args.version, image, ", .gz %d Bytes (%.0f %%)" % (gz, gz * 100.0 / image) if gz else ""),
+        flush=True)
+
+    server = ThreadingHTTPServer(("", args.port), Handler)
+    if not args.device:
+        try:
+            server.serve_forever()
+        except KeyboardInterrupt:
+            pass
+    else:
+        threading.Thread(target=server.serve_forever, daemon=True).start()
+        ok = run_device(args.device)
+        server.shutdown()
+
+    if stats.requests:
+        print("Server: %d Anfragen über %d Verbindung(en), %d Bytes in %.0f ms"
+              % (stats.requests, len(stats.connections), stats.bytes, (stats.last - stats.first) * 1000))
+    if args.device:
+        sys.exit(0 if ok else 1)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,235 @@
+#!/usr/bin/env python3
+# Lokaler Ersatz für wttr.in und Open-Meteo (Offline-Test der Wetter-Parser).
+#
+# Liefert die aufgezeichneten Antworten aus extra_scripts/fixtures/ und setzt
+# bei jedem Abruf einen anderen aktuellen Wettercode ein, sodass nacheinander
+# jede WeatherCondition durchlaufen wird. Zu jeder Antwort steht die erwartete
+# Log-Zeile des Geräts auf der Konsole.
+#
+# Gerät umbiegen (platformio.ini, build_flags):
+#   -D WTTR_BASE_URL=\"http://<PC-IP>:8080\"
+#   -D OPEN_METEO_BASE_URL=\"http://<PC-IP>:8080\"
+#   -D OPEN_METEO_GEO_URL=\"http://<PC-IP>:8080\"
+#   (für wttr.in WEATHER_PROVIDER_OPEN_METEO in config.h auskommentieren)
+#
+# Start:  python3 extra_scripts/weather_standin.py [--port 8080] [--device <IP>]
+# Mit --device stößt das Skript über die Stadt-Einstellung Abrufe an, liest
+# das Ergebnis aus /api/logs und vergleicht es mit der Erwartung.
+
+import argparse
+import json
+import math
+import os
+import re
+import sys
+import threading
+import time
+import urllib.request
+from http.server import BaseHTTPRequestHandler, ThreadingHTTPServer
+from urllib.parse import urlparse, parse_qs
+
+FIXTURES = os.path.join(os.path.dirname(os.path.abspath(__file__)), "fixtures")
+FORECAST_SLOTS = 16
+
+# Spiegel von WttrJsonProvider::mapCode / OpenMeteoProvider::mapCode
+WWO = {
+    "Clear": [113],
+    "Cloud": [116, 119, 122],
+    "Fog": [143, 248, 260],
+    "Thunder": [200, 386, 389, 392, 395],
+    "Rain": [176, 263, 266, 281, 284, 293, 296, 299, 302, 305, 308, 311, 314, 353, 356, 359],
+    "Snow": [179, 182, 185, 227, 230, 317, 320, 323, 326, 329, 332, 335, 338, 350, 362, 365, 368, 371, 374, 377],
+}
+WMO = {
+    "Clear": [0, 1],
+    "Cloud": [2, 3],
+    "Fog": [45, 48],
+    "Rain": [51, 53, 55, 56, 57, 61, 63, 65, 66, 67, 80, 81, 82],
+    "Snow": [71, 73, 75, 77, 85, 86],
+    "Thunder": [95, 96, 99],
+}
+
+
+def condition(table, code):
+    for name, codes in table.items():
+        if code in codes:
+            return name
+    return "Unknown"
+
+
+# Aktuelle Codes, die der Reihe nach ausgeliefert werden (inkl. unbekanntem Code)
+WTTR_SCENARIOS = [296, 113, 122, 338, 389, 248, 999]
+OPEN_METEO_SCENARIOS = [61, 0, 3, 75, 95, 45, 42]
+
+
+def lround(x):
+    # wie lroundf: .5 von der Null weg
+    return int(math.floor(abs(x) + 0.5)) * (1 if x >= 0 else -1)
+
+
+def load(name):
+    with open(os.path.join(FIXTURES, name), encoding="utf-8") as f:
+        return json.load(f)
+
+
+class State:
+    def __init__(self):
+        self.lock = threading.Lock()
+        self.count = {"wttr": 0, "open-meteo": 0}
+        self.expected = []          # (provider, temp, condition, slots, min, max)
+
+    def next(self, provider):
+        with self.lock:
+            i = self.count[provider]
+            self.count[provider] += 1
+            return i
+
+
+state = State()
+
+
+def wttr_body(i):
+    doc = load("wttr_j1.json")
+    code = WTTR_SCENARIOS[i % len(WTTR_SCENARIOS)]
+    cur = doc["current_condition"][0]
+    cur["weatherCode"] = str(code)
+    temp = float(cur["temp_C"])
+
+    # Wie WttrJsonProvider::parse: ab dem aktuellen 3h-Slot (Ortszeit des PCs)
+    now_hhmm = (time.localtime().tm_hour // 3) * 300
+    temps = []
+    first = True
+    for day in doc["weather"]:
+        for h in day["hourly"]:
+            if first and int(h["time"]) < now_hhmm:
+                continue
+            temps.append(int(h["tempC"]))
+        first = False
+    temps = temps[:FORECAST_SLOTS]
+    return doc, ("wttr.in", temp, condition(WWO, code), len(temps), min(temps), max(temps))
+
+
+def open_meteo_body(i):
+    doc = load("open_meteo_forecast.json")
+    code = OPEN_METEO_SCENARIOS[i % len(OPEN_METEO_SCENARIOS)]
+    doc["current"]["weather_code"] = code
+    temps = [lround(t) for t in doc["hourly"]["temperature_2m"][::3]][:FORECAST_SLOTS]
+    return doc, ("open-meteo", doc["current"]["temperature_2m"], condition(WMO, code), len(temps), min(temps), max(temps))
+
+
+def expected_line(e):
+    return "%s: %.1f°C, %s, Vorhersage %d Slots (%d..%d°C)" % e
+
+
+class Handler(BaseHTTPRequestHandler):
+    protocol_version = "HTTP/1.0"   # wie das Gerät (useHTTP10)
+
+    def do_GET(self):
+        url = urlparse(self.path)
+        query = parse_qs(url.query)
+        if url.path == "/v1/search":
+            self.send_json(load("open_meteo_geocoding.json"))
+        elif url.path == "/v1/forecast":
+            doc, e = open_meteo_body(state.next("open-meteo"))
+            self.send_json(doc, e)
+        elif query.get("format") == ["j1"]:
+            doc, e = wttr_body(state.next("wttr"))
+            self.send_json(doc, e)
+        else:
+            self.send_error(404)
+
+    def send_json(self, doc, expected=None):
+        body = json.dumps(doc, ensure_ascii=False).encode("utf-8")
+        self.send_response(200)
+        self.send_header("Content-Type", "application/json; charset=utf-8")
+        self.send_header("Content-Length", str(len(body)))
+        self.end_headers()
+        self.wfile.write(body)
+        if expected:
+            with state.lock:
+                state.expected.append(expected)
+            print("  erwartet: " + expected_line(expected), flush=True)
+
+    def log_message(self, fmt, *args):
+        print("%s %s" % (self.address_string(), fmt % args), flush=True)
+
+
+# ------------------------------------------------------
+# Gegenprobe am Gerät
+# ------------------------------------------------------
+LINE = re.compile(r"^(\S+): (-?[\d.]+)°C, (\w+), Vorhersage (\d+) Slots \((-?\d+)\.\.(-?\d+)°C\)")
+
+
+def device_get(device, path):
+    with urllib.request.urlopen("http://%s%s" % (device, path), timeout=5) as r:
+        return json.loads(r.read().decode("utf-8"))
+
+
+def device_set_city(device, city):
+    req = urllib.request.Request("http://%s/api/settings" % device, data=json.dumps({"city": city}).encode(),
+                                 headers={"Content-Type": "application/json"}, method="POST")
+    urllib.request.urlopen(req, timeout=5).read()
+
+
+def check_device(device, rounds):
+    # Bis ans Ende blättern, damit nur neue Log-Zeilen zählen
+    logs = {"next": 0, "more": True}
+    while logs.get("more"):
+        logs = device_get(device, "/api/logs?since=%d" % logs["next"])
+    since = logs.get("next", 0)
+    cities = ["Detmold", "Lemgo"]
+    failures = 0
+    for n in range(rounds):
+        with state.lock:
+            before = len(state.expected)
+        device_set_city(device, cities[n % 2])
+
+        got = None
+        deadline = time.time() + 30
+        while time.time() < deadline and got is None:
+            time.sleep(1)
+            logs = device_get(device, "/api/logs?since=%d" % since)
+            since = logs.get("next", since)
+            for entry in logs.get("entries", []):
+                m = LINE.match(entry["msg"]) if entry["module"] == "Weather" else None
+                if m:
+                    got = (m.group(1), float(m.group(2)), m.group(3), int(m.group(4)), int(m.group(5)), int(m.group(6)))
+
+        with state.lock:
+            expected = state.expected[before] if len(state.expected) > before else None
+        if got is None or expected is None:
+            print("FEHLER: Runde %d ohne Abruf/Log-Zeile" % (n + 1))
+            failures += 1
+            continue
+        # wttr.in-Slots hängen von der Geräteuhr ab → nur Provider, Temperatur, Bedingung streng
+        ok = got[:3] == (expected[0], round(expected[1], 1), expected[2])
+        if expected[0] == "open-meteo":
+            ok = ok and got[3:] == expected[3:]
+        print("%s: %s" % ("OK    " if ok else "FEHLER", expected_line(got)))
+        failures += 0 if ok else 1
+
+    print("%d/%d Runden ok" % (rounds - failures, rounds))
+    return failures == 0
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Lokaler Wetter-Server mit aufgezeichneten Antworten")
+    parser.add_argument("--port", type=int, default=8080)
+    parser.add_argument("--device", help="IP des Geräts für die automatische Gegenprobe")
+    parser.add_argument("--rounds", type=int, default=len(OPEN_METEO_SCENARIOS))
+    args = parser.parse_args()
+
+    server = ThreadingHTTPServer(("", args.port), Handler)
+    print("Wetter-Ersatz auf Port %d (Fixtures: %s)" % (args.port, FIXTURES), flush=True)
+    if not args.device:
+        server.serve_forever()
+        return
+
+    threading.Thread(target=server.serve_forever, daemon=True).start()
+    ok = check_device(args.device, args.rounds)
+    server.shutdown()
+    sys.exit(0 if ok else 1)
+
+
+if __name__ == "__main__":
+    main()
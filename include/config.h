@@ -11,8 +11,9 @@
 // Anzahl der verfügbaren Anzeigemodi (0..N)
 // 0: Uhrzeit, 1: Sekunden, 2: Datum, 3: Wetter,
 // 4: Auto Uhrzeit/Sekunden, 5: Game of Life, 6: Pong,
-// 7: WiFi-Signal, 8: Matrix Rain, 9: Display aus (immer letzter)
-#define DISPLAYMODES 9
+// 7: WiFi-Signal, 8: Matrix Rain, 9: Vorhersage (Temperatur/Regen),
+// 10: Display aus (immer letzter)
+#define DISPLAYMODES 10
 
 #define DISPLAY_WIDTH 16
 #define DISPLAY_HEIGHT 16
@@ -28,8 +29,43 @@
 
 #define CITY "Detmold"  // für Wetter-API
 
+// Wetter-Anbieter: Open-Meteo (kompakt, ~1 KB) statt wttr.in j1 (~50 KB)
+#define WEATHER_PROVIDER_OPEN_METEO
+// Basis-URLs (für Offline-Tests per build_flags auf extra_scripts/weather_standin.py umbiegbar)
+#ifndef WTTR_BASE_URL
+#define WTTR_BASE_URL "https://wttr.in"
+#endif
+#ifndef OPEN_METEO_BASE_URL
+#define OPEN_METEO_BASE_URL "https://api.open-meteo.com"
+#endif
+#ifndef OPEN_METEO_GEO_URL
+#define OPEN_METEO_GEO_URL "https://geocoding-api.open-meteo.com"
+#endif
+
 #define AP_NAME "OBEGRÄNSAD-X"
 #define AP_PASSWORD ""
 #define WEB_SERVER_PORT 80
+
+// Strombudget des Netzteils in mA (Schätzung aus leuchtenden Pixeln × PWM);
+// darüber wird das Panel automatisch gedimmt
+#define POWER_BUDGET_MA 1000
+
+// Pixel-Streaming vom PC (DDP, z. B. xLights/LedFx/WLED-Sender)
+#define DDP_PORT 4048
+// Ohne Pakete für diese Zeit → zurück zum eingestellten Modus
+#define DDP_TIMEOUT_MS 2500
+
+// Update-Quelle (für Offline-Tests per build_flags auf extra_scripts/ota_standin.py umbiegbar)
+#ifndef OTA_VERSION_URL
 #define OTA_VERSION_URL "https://github.com/Zenonik/obegraensad-x/releases/latest/download/version.txt"
-#define OTA_FIRMWARE_URL "https://github.com/Zenonik/obegraensad-x/releases/latest/download/firmware.bin"
\ No newline at end of file
+#endif
+#ifndef OTA_FIRMWARE_URL
+#define OTA_FIRMWARE_URL "https://github.com/Zenonik/obegraensad-x/releases/latest/download/firmware.bin"
+#endif
+// Komprimiertes Image (gzip); fehlt es, wird firmware.bin geladen
+#ifndef OTA_FIRMWARE_GZ_URL
+#define OTA_FIRMWARE_GZ_URL "https://github.com/Zenonik/obegraensad-x/releases/latest/download/firmware.bin.gz"
+#endif
+#ifndef OTA_SHA256_URL
+#define OTA_SHA256_URL "https://github.com/Zenonik/obegraensad-x/releases/latest/download/firmware.bin.sha256"
+#endif
\ No newline at end of file
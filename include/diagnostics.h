@@ -0,0 +1,112 @@
+#pragma once
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include "metrics.h"
+
+// ============================================================
+// Hänger- und Absturzdiagnose
+// - Task-Watchdog für loopTask und LogTask (AsyncTCP meldet sich
+//   selbst an): hängt ein Task länger als DIAG_WDT_TIMEOUT_S → Reset
+// - der Haupt-loop markiert, welches Teilsystem gerade läuft; wer sein
+//   Zeitbudget überzieht, wird als "stall" mit Dauer festgehalten
+// - Flugschreiber: Ring der letzten Ereignisse (Moduswechsel, Abrufe,
+//   wenig Heap, Hänger, Neustarts) im RTC-Speicher, übersteht Reset,
+//   Panic und Watchdog; Bericht beim nächsten Start auf Serial und
+//   unter /api/diagnostics
+// ============================================================
+
+#ifndef DIAG_WDT_TIMEOUT_S
+#define DIAG_WDT_TIMEOUT_S 15        // > checkWiFi()-Wartezeit (5 s)
+#endif
+#ifndef DIAG_EVENT_COUNT
+#define DIAG_EVENT_COUNT 32
+#endif
+#ifndef DIAG_HEAP_LOW_BYTES
+#define DIAG_HEAP_LOW_BYTES 24000
+#endif
+#ifndef DIAG_FETCH_BUDGET_MS
+#define DIAG_FETCH_BUDGET_MS 10000   // längere Abrufe (außer Firmware-Image) zählen als Hänger
+#endif
+
+// Abschnitte des Haupt-loops (Reihenfolge = Budget-Tabelle in diagnostics.cpp)
+enum class DiagStage : uint8_t {
+    Setup,
+    Idle,
+    Web,
+    Button,
+    Ota,
+    Panel,
+    Display,
+    Weather,
+    WiFi,
+    Https,
+    Brightness,
+    Settings,
+    Animation,
+    History,
+    COUNT
+};
+
+enum class DiagEvent : uint8_t {
+    Boot,          // detail = Reset-Grund, arg = Abschnitt beim Reset
+    Restart,       // geplanter Neustart (esp_restart)
+    Mode,          // detail = neuer Modus
+    Fetch,         // detail = FetchSource, arg = ms (negativ = fehlgeschlagen)
+    HeapLow,       // arg = freie Bytes
+    Stall,         // detail = DiagStage, arg = ms
+    WiFiLost,
+    COUNT
+};
+
+struct DiagRecord {
+    uint32_t time;        // Unix-Zeit, 0 = Uhr noch nicht gestellt
+    uint32_t ms;          // millis() seit dem jeweiligen Start
+    int32_t arg;
+    uint16_t boot;        // Startzähler → Zuordnung über Resets hinweg
+    uint16_t repeat;      // gleiche Ereignisse direkt hintereinander zusammengefasst
+    DiagEvent type;
+    uint8_t detail;
+};
+
+class Diagnostics {
+public:
+    // Direkt nach Serial.begin(): RTC-Ring prüfen, Reset auswerten, Bericht ausgeben
+    void begin();
+    // Aufrufenden Task beim Task-Watchdog anmelden / füttern
+    void watchCurrentTask();
+    void feed();
+
+    // Haupt-loop: nächsten Abschnitt beginnen, vorherigen gegen sein Budget prüfen
+    void stage(DiagStage next);
+    // Einmal pro Sekunde Heap prüfen (aus dem Haupt-loop)
+    void loop();
+
+    void record(DiagEvent type, uint8_t detail = 0, int32_t arg = 0);
+    // Abruf festhalten; dauert er länger als DIAG_FETCH_BUDGET_MS, zusätzlich als Hänger
+    void recordFetch(FetchSource source, uint32_t ms, bool ok);
+
+    // {"boot":u,"resetReason":str,"resetStage":str,"stalls":{stage:u,...},
+    //  "events":[{"boot":u,"time":u,"ms":u,"type":str,"detail":str|u,"arg":i,"repeat":u},...]}
+    size_t serialize(char *out, size_t len) const;
+
+    uint32_t getStalls(DiagStage s) const { return stalls[(uint8_t)s]; }
+
+    static const char *stageName(DiagStage s);
+    static const char *eventName(DiagEvent e);
+    static const char *resetReasonName(uint8_t reason);
+
+private:
+    uint8_t resetReason = 0;
+    uint8_t resetStage = 0;          // Abschnitt, in dem der letzte Start endete
+    uint32_t stalls[(uint8_t)DiagStage::COUNT] = {0};
+    unsigned long lastHeapCheck = 0;
+    bool heapLow = false;
+    mutable portMUX_TYPE mux = portMUX_INITIALIZER_UNLOCKED;
+
+    static void onShutdown();
+    static size_t describe(const DiagRecord &r, char *out, size_t len);
+    void printReport() const;
+};
+
+extern Diagnostics diagnostics;
@@ -2,6 +2,8 @@
 #define DISPLAY_H
 
 #include <Arduino.h>
+#include "weather_condition.h"
+#include "panel_dimmer.h"
 
 // ============================================================
 // Display.h
@@ -25,7 +27,15 @@ public:
     void update();
 
     // 🔆 Anzeigeeinstellungen
+    // Globale Helligkeit (Einstellung), sofort bzw. als Übergang
     void setBrightness(uint8_t brightness);
+    void fadeBrightness(uint8_t brightness, uint16_t ms);
+    // Effekte: vorübergehende Helligkeit, danach zurück zur globalen
+    void showBrightness(uint8_t level) { dimmer.show(level); }
+    void flashBrightness(uint8_t from, uint8_t to, uint16_t ms) { dimmer.flash(from, to, ms); }
+    void restoreBrightness(uint16_t ms = DIMMER_RESTORE_MS) { dimmer.restore(ms); }
+    // Im Haupt-loop: vom Dimmer-Timer abgegebene Übergangsschritte ausführen
+    void handleBrightness() { dimmer.loop(); }
     void setPixel(uint8_t x, uint8_t y, bool state);
 
     // 🔢 Zeichnen von Zeichen & Text
@@ -43,13 +53,24 @@ public:
     void animateCheckmark();
 
     // 🌤️ Wetteranzeige (Temperatur + Icon/Text)
-    void drawWeather(float temp, const String& cond, WeatherMode mode);
+    void drawWeather(float temp, WeatherCondition cond, WeatherMode mode);
+
+    // 📈 Spaltengrafik (Bit y je Spalte x, z. B. Vorhersage-Sparkline)
+    void drawColumns(const uint16_t columns[16]);
+
+    // 🖼️ Gepackter 1-bpp-Frame (32 Byte, zeilenweise, MSB = links), z. B. DDP-Stream
+    void drawBitmap(const uint8_t bits[32]);
 
     // 🔄 Asynchrone Animation (z. B. Hintergrundeffekte)
     void startAsyncAnimation();
     void stopAsyncAnimation();
     void handleAsyncAnimation();
 
+    // 🪞 Zuletzt ausgegebener Frame (gepackt 1 bpp, 32 Byte, Blickrichtung des Betrachters)
+    // wird beim Hinausschieben in update() mitgeschrieben, ohne zusätzliche Kopie
+    const uint8_t* getPresentedFrame() const { return presented; }
+    uint32_t getPresentedCount() const { return presentedCount; }
+
     // 🧪 Debug-/Testfunktionen
     void drawScrollingText(const char* text, int offset);
     void testSinglePixel(uint8_t x, uint8_t y);
@@ -60,6 +81,11 @@ private:
     // 🧩 Interner Framebuffer (Helligkeitswerte 0–255)
     uint8_t framebuffer[16][16];
     uint8_t brightness;
+    PanelDimmer dimmer;
+
+    // 🪞 Spiegel des zuletzt gelatchten Frames
+    uint8_t presented[32] = {0};
+    uint32_t presentedCount = 0;
 
     // 🧠 Interner Zustand für Animationen
     bool animationActive;
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <Arduino.h>
+#include <ESPAsyncWebServer.h>
+#include <atomic>
+
+// Maximale Bildrate der Vorschau (Frames pro Sekunde)
+#define MIRROR_MAX_FPS 10
+
+// ============================================================
+// Live-Vorschau des Panels per WebSocket (/ws/display)
+// - liest den beim Latchen gepackten Frame (Display::getPresentedFrame)
+// - sendet nur bei Änderung, höchstens MIRROR_MAX_FPS
+// - Binärformat:
+//   'K' + 32 Byte                       → kompletter Frame (Keyframe)
+//   'D' + 4 Byte Maske (BE) + n Byte    → nur geänderte Bytes (Bit i = Byte i)
+// ============================================================
+class DisplayMirror {
+public:
+    DisplayMirror();
+    void begin(AsyncWebServer &server);
+    // Im Haupt-Task aufrufen (gleicher Task wie Display::update)
+    void loop();
+
+    uint32_t getBytesSent() const { return bytesSent; }
+
+private:
+    AsyncWebSocket ws;
+    std::atomic<bool> resync{false};   // neuer Client → nächster Frame als Keyframe
+    uint8_t lastSent[32] = {0};
+    uint32_t lastCount = 0;
+    unsigned long lastSend = 0;
+    unsigned long lastCleanup = 0;
+    uint32_t bytesSent = 0;
+};
+
+extern DisplayMirror displayMirror;
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <stdint.h>
+
+// ============================================================
+// Heap-Zähler für die API-Handler (Nachweis "keine Allokation pro Anfrage")
+// - nur mit -D HEAP_PROBE und den --wrap-Linkerflags aus platformio.ini:
+//   malloc/calloc/realloc laufen dann über heap_probe.cpp
+// - gezählt wird nur im Task, der gerade misst, also nicht was Haupt-loop,
+//   Logger oder Wetter-Task parallel anfordern (eine Messung zur Zeit, die
+//   Handler laufen alle im async_tcp-Task)
+// - HEAP_PROBE_PAUSE() blendet Allokationen der Bibliothek aus
+//   (ESPAsyncWebServer legt für jede Antwort ein Objekt an)
+// - Ergebnis pro Route unter /metrics:
+//   obegraensad_http_heap_allocations_total
+// ============================================================
+
+#ifdef HEAP_PROBE
+
+// Messung im aktuellen Task beginnen / beenden (Anzahl Allokationen)
+void heapProbeStart();
+uint32_t heapProbeStop();
+
+class HeapProbePause {
+public:
+    HeapProbePause();
+    ~HeapProbePause();
+
+private:
+    bool wasPaused;
+};
+
+#define HEAP_PROBE_PAUSE() HeapProbePause heapProbePause_
+
+#else
+
+static inline void heapProbeStart() {}
+static inline uint32_t heapProbeStop() { return 0; }
+#define HEAP_PROBE_PAUSE() ((void)0)
+
+#endif
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <Arduino.h>
+#include <WiFiClientSecure.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+
+// ============================================================
+// Gemeinsamer HTTPS-Verbindungspool (Wetter, OTA-Versionscheck, OTA-Download)
+// - begrenzt gleichzeitige TLS-Kontexte (je ~40 KB Heap)
+// - hält Keep-Alive-Verbindungen pro Host offen und verwendet sie wieder
+//   (OTA: version.txt, Prüfsumme und Image kurz hintereinander auf
+//   github.com und dem CDN; Wetter nutzt HTTP/1.0 und schließt)
+// - protokolliert Handshake-Dauer und Heap-Verbrauch pro Verbindung
+// ============================================================
+
+// Maximale Anzahl gleichzeitiger TLS-Kontexte
+#ifndef HTTPS_MAX_TLS_CONTEXTS
+#define HTTPS_MAX_TLS_CONTEXTS 2
+#endif
+
+// Offene Keep-Alive-Verbindungen nach dieser Leerlaufzeit schließen (Heap freigeben)
+#ifndef HTTPS_IDLE_TIMEOUT_MS
+#define HTTPS_IDLE_TIMEOUT_MS 30000UL
+#endif
+
+// Länge für gespeicherte Hostnamen (inkl. Nullterminator)
+#ifndef HTTPS_HOST_MAX_LEN
+#define HTTPS_HOST_MAX_LEN 64
+#endif
+
+class HttpsPool {
+public:
+    void begin();
+
+    // Verbindung zu host:port leasen. Ist noch eine offene Keep-Alive-Verbindung
+    // zum selben Host vorhanden, entfällt der TLS-Handshake.
+    // nullptr, wenn innerhalb waitMs kein TLS-Kontext frei wird oder der Connect scheitert.
+    WiFiClientSecure* acquire(const char* host, uint16_t port = 443, uint32_t waitMs = 10000);
+
+    // URL-Variante (https://host[:port]/...)
+    WiFiClientSecure* acquire(const String& url, uint32_t waitMs = 10000);
+
+    // Lease zurückgeben. keepAlive=false schließt die Verbindung
+    // (z. B. nach Redirects, wenn der Client auf einem anderen Host gelandet ist).
+    void release(WiFiClientSecure* client, bool keepAlive = true);
+
+    // Leerlaufende Verbindungen schließen (in loop() aufrufen, prüft max. 1x/s)
+    void closeIdle();
+
+    // 📊 Statistik
+    uint32_t getHandshakes() const { return handshakes; }
+    uint32_t getReuses() const { return reuses; }
+    uint32_t getLastHandshakeMs() const { return lastHandshakeMs; }
+    uint32_t getMaxHandshakeMs() const { return maxHandshakeMs; }
+
+    // Host aus einer URL extrahieren (ohne Allokation)
+    static bool parseUrl(const String& url, char* host, size_t hostLen, uint16_t& port);
+
+private:
+    struct Slot {
+        WiFiClientSecure client;
+        char host[HTTPS_HOST_MAX_LEN] = {0};
+        uint16_t port = 0;
+        bool inUse = false;
+        unsigned long lastUsed = 0;
+    };
+
+    Slot slots[HTTPS_MAX_TLS_CONTEXTS];
+    SemaphoreHandle_t available = nullptr;  // zählt freie TLS-Kontexte
+    SemaphoreHandle_t lock = nullptr;       // schützt slots[]
+    unsigned long lastIdleCheck = 0;
+
+    uint32_t handshakes = 0;
+    uint32_t reuses = 0;
+    uint32_t lastHandshakeMs = 0;
+    uint32_t maxHandshakeMs = 0;
+};
+
+extern HttpsPool httpsPool;
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <Arduino.h>
+
+// ============================================================
+// Minimaler JSON-Writer in einen festen Puffer
+// - keine Heap-Allokation (Puffer stellt der Aufrufer, meist auf dem Stack)
+// - Strings werden korrekt escaped (", \, Steuerzeichen)
+// - bei Überlauf bleibt der Puffer nullterminiert, ok() liefert false
+// ============================================================
+
+// Maximale Verschachtelungstiefe (Objekte/Arrays)
+#define JSON_WRITER_MAX_DEPTH 8
+
+class JsonWriter {
+public:
+    JsonWriter(char* buffer, size_t capacity);
+
+    JsonWriter& beginObject(const char* key = nullptr);
+    JsonWriter& endObject();
+    JsonWriter& beginArray(const char* key = nullptr);
+    JsonWriter& endArray();
+
+    // Felder in Objekten (key != nullptr) bzw. Werte in Arrays (key == nullptr)
+    JsonWriter& add(const char* key, const char* value);
+    // int/long getrennt überladen, da int32_t je nach Toolchain int oder long ist
+    JsonWriter& add(const char* key, int value) { return addSigned(key, value); }
+    JsonWriter& add(const char* key, long value) { return addSigned(key, value); }
+    JsonWriter& add(const char* key, unsigned int value) { return addUnsigned(key, value); }
+    JsonWriter& add(const char* key, unsigned long value) { return addUnsigned(key, value); }
+    JsonWriter& add(const char* key, float value, uint8_t decimals = 1);
+    JsonWriter& add(const char* key, double value, uint8_t decimals = 1) { return add(key, (float)value, decimals); }
+    JsonWriter& addBool(const char* key, bool value);
+    JsonWriter& addNull(const char* key);
+
+    bool ok() const { return !overflow && depth == 0; }
+    const char* c_str() const { return buf; }
+    size_t length() const { return len; }
+
+private:
+    char* buf;
+    size_t cap;
+    size_t len = 0;
+    bool overflow = false;
+    uint8_t depth = 0;
+    uint8_t hasItems = 0;   // Bit d = Ebene d hat schon ein Element (Komma nötig)
+
+    JsonWriter& addSigned(const char* key, long value);
+    JsonWriter& addUnsigned(const char* key, unsigned long value);
+    void raw(const char* s, size_t n);
+    void raw(const char* s) { raw(s, strlen(s)); }
+    void rawChar(char c) { raw(&c, 1); }
+    void escaped(const char* s);
+    void prefix(const char* key);
+    void open(const char* key, char bracket);
+    void close(char bracket);
+};
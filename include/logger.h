@@ -0,0 +1,170 @@
+#pragma once
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <atomic>
+
+// ============================================================
+// Ringpuffer-Logger mit verzögerter Formatierung
+// - Aufrufer legen nur einen Binärdatensatz ab (Zeit, Level, Modul,
+//   Formatzeiger, Argumente, kurze Strings kopiert) – kein printf,
+//   keine String-Verkettung, kein Warten auf die UART
+// - Warteschlange lock-frei (mehrere Erzeuger, ein Verbraucher),
+//   bei Überlauf wird verworfen und gezählt
+// - ein Task niedriger Priorität formatiert und schreibt auf Serial,
+//   die letzten LOG_HISTORY_SIZE Einträge liefert /api/logs
+// - Format-Strings müssen Literale sein (es wird nur der Zeiger gespeichert)
+// ============================================================
+
+#ifndef LOG_QUEUE_SIZE
+#define LOG_QUEUE_SIZE 32        // Zweierpotenz
+#endif
+#ifndef LOG_HISTORY_SIZE
+#define LOG_HISTORY_SIZE 48
+#endif
+#define LOG_MAX_ARGS 6
+#define LOG_TEXT_LEN 40          // Platz für %s-Argumente (abgeschnitten)
+#define LOG_LINE_LEN 160
+
+#ifndef LOG_DEFAULT_LEVEL
+#define LOG_DEFAULT_LEVEL LogLevel::Info
+#endif
+
+enum class LogLevel : uint8_t {
+    Debug,
+    Info,
+    Warn,
+    Error,
+    Off
+};
+
+enum class LogModule : uint8_t {
+    Main,
+    Display,
+    Web,
+    WiFi,
+    Time,
+    Weather,
+    OTA,
+    Settings,
+    HTTPS,
+    DDP,
+    History,
+    Game,
+    COUNT
+};
+
+struct LogRecord {
+    uint32_t seq;                 // fortlaufend (für /api/logs?since=)
+    uint32_t ms;
+    const char *fmt;
+    LogLevel level;
+    LogModule module;
+    uint8_t argc;
+    uint8_t textLen;
+    uint32_t args[LOG_MAX_ARGS];  // Ganzzahlen roh, float als Bitmuster
+    char text[LOG_TEXT_LEN];      // %s-Argumente, jeweils nullterminiert
+};
+
+class Logger {
+public:
+    Logger();
+
+    // Formatier-Task starten (so früh wie möglich in setup())
+    void begin();
+
+    bool enabled(LogModule module, LogLevel level) const {
+        return (uint8_t)level >= levels[(uint8_t)module];
+    }
+
+    template <typename... Args>
+    void log(LogModule module, LogLevel level, const char *fmt, const Args &...args) {
+        LogRecord r;
+        r.ms = millis();
+        r.fmt = fmt;
+        r.level = level;
+        r.module = module;
+        r.argc = 0;
+        r.textLen = 0;
+        capture(r, args...);
+        push(r);
+    }
+
+    // Warteschlange sofort ausgeben (z. B. vor ESP.restart())
+    void flush();
+
+    void setLevel(LogModule module, LogLevel level);
+    void setLevelAll(LogLevel level);
+    LogLevel getLevel(LogModule module) const { return (LogLevel)levels[(uint8_t)module]; }
+    uint32_t getDropped() const { return dropped.load(); }
+
+    // Einträge aus der Historie mit seq >= since (älteste zuerst); false = keine weiteren
+    bool copyRecent(uint32_t since, LogRecord &out) const;
+    static size_t format(const LogRecord &r, char *out, size_t len);
+
+    static const char *moduleName(LogModule module);
+    static const char *levelName(LogLevel level);
+    static bool parseModule(const char *name, LogModule &module);
+    static bool parseLevel(const char *name, LogLevel &level);
+
+private:
+    // Vyukov-Warteschlange: Zelle frei für Position p, wenn seq == p
+    struct Cell {
+        std::atomic<uint32_t> seq;
+        LogRecord record;
+    };
+    Cell cells[LOG_QUEUE_SIZE];
+    std::atomic<uint32_t> head{0};
+    uint32_t tail = 0;
+    std::atomic<bool> draining{false};
+    std::atomic<uint32_t> dropped{0};
+
+    volatile uint8_t levels[(uint8_t)LogModule::COUNT];
+
+    LogRecord history[LOG_HISTORY_SIZE];
+    uint32_t nextSeq = 0;
+    mutable portMUX_TYPE historyMux = portMUX_INITIALIZER_UNLOCKED;
+
+    TaskHandle_t task = nullptr;
+
+    void push(const LogRecord &r);
+    bool drain();
+    static void taskEntry(void *arg);
+
+    // Argumente erfassen (Typ entscheidet, der Formatstring liest zurück)
+    static void capture(LogRecord &) {}
+    template <typename T, typename... Rest>
+    static void capture(LogRecord &r, const T &value, const Rest &...rest) {
+        addArg(r, value);
+        capture(r, rest...);
+    }
+    static void addRaw(LogRecord &r, uint32_t raw) {
+        if (r.argc < LOG_MAX_ARGS) r.args[r.argc++] = raw;
+    }
+    static void addArg(LogRecord &r, int v) { addRaw(r, (uint32_t)v); }
+    static void addArg(LogRecord &r, unsigned int v) { addRaw(r, v); }
+    static void addArg(LogRecord &r, long v) { addRaw(r, (uint32_t)v); }
+    static void addArg(LogRecord &r, unsigned long v) { addRaw(r, (uint32_t)v); }
+    // 64-Bit-Werte werden auf 32 Bit gekürzt (Formatierung kennt nur 32 Bit)
+    static void addArg(LogRecord &r, long long v) { addRaw(r, (uint32_t)v); }
+    static void addArg(LogRecord &r, unsigned long long v) { addRaw(r, (uint32_t)v); }
+    static void addArg(LogRecord &r, float v);
+    static void addArg(LogRecord &r, double v) { addArg(r, (float)v); }
+    static void addArg(LogRecord &r, const char *s);
+    static void addArg(LogRecord &r, const String &s) { addArg(r, s.c_str()); }
+};
+
+extern Logger logger;
+
+// Argumente werden nur ausgewertet, wenn das Level für das Modul aktiv ist
+#define LOG_AT(level, module, fmt, ...) \
+    do { \
+        if (logger.enabled(LogModule::module, level)) \
+            logger.log(LogModule::module, level, fmt, ##__VA_ARGS__); \
+    } while (0)
+
+#define LOG_DEBUG(module, fmt, ...) LOG_AT(LogLevel::Debug, module, fmt, ##__VA_ARGS__)
+#define LOG_INFO(module, fmt, ...) LOG_AT(LogLevel::Info, module, fmt, ##__VA_ARGS__)
+#define LOG_WARN(module, fmt, ...) LOG_AT(LogLevel::Warn, module, fmt, ##__VA_ARGS__)
+#define LOG_ERROR(module, fmt, ...) LOG_AT(LogLevel::Error, module, fmt, ##__VA_ARGS__)
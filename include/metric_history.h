@@ -0,0 +1,111 @@
+#pragma once
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+
+// ============================================================
+// Metrik-Verlauf (RRD-artig, feste Speichergröße)
+// - 1-Hz-Stichproben von Heap, größtem Heap-Block, Loop-Dauer,
+//   RSSI und Display-Push-Zeit
+// - verdichtet zu Minuten-, Stunden- und Tagespunkten mit Min/Mittel/Max
+// - Stunden- und Tagesstufe werden selten in NVS gesichert und
+//   überstehen so Neustarts und OTA-Updates
+// ============================================================
+
+#ifndef HISTORY_MINUTE_POINTS
+#define HISTORY_MINUTE_POINTS 60     // 1 Stunde
+#endif
+#ifndef HISTORY_HOUR_POINTS
+#define HISTORY_HOUR_POINTS 48       // 2 Tage
+#endif
+#ifndef HISTORY_DAY_POINTS
+#define HISTORY_DAY_POINTS 30        // 30 Tage
+#endif
+
+// Stunden zwischen zwei NVS-Sicherungen (0 = nie sichern)
+#ifndef HISTORY_PERSIST_HOURS
+#define HISTORY_PERSIST_HOURS 6
+#endif
+
+enum class HistorySeries : uint8_t {
+    HeapFree,
+    HeapLargest,
+    LoopUs,
+    Rssi,
+    FrameUs,
+    COUNT
+};
+#define HISTORY_SERIES ((uint8_t)HistorySeries::COUNT)
+
+enum class HistoryTier : uint8_t {
+    Minute,
+    Hour,
+    Day,
+    COUNT
+};
+
+// Werte kodiert als uint16 (Skalierung je Reihe, siehe metric_history.cpp)
+#define HISTORY_NO_DATA 0xFFFF      // Reihe ohne Stichprobe im Intervall
+struct HistoryPoint {
+    uint32_t time;                    // Unix-Zeit am Ende des Intervalls, 0 = unbekannt
+    uint16_t min[HISTORY_SERIES];
+    uint16_t avg[HISTORY_SERIES];
+    uint16_t max[HISTORY_SERIES];
+};
+
+class MetricHistory {
+public:
+    // Gesicherte Stunden-/Tagespunkte aus NVS laden
+    void begin();
+    // Im Haupt-loop aufrufen; nimmt einmal pro Sekunde eine Stichprobe
+    void loop();
+    // Stunden-/Tagesstufe sofort sichern (z. B. vor einem Neustart)
+    void flush();
+
+    // JSON einer Stufe in den Puffer schreiben; Länge oder 0 bei Überlauf
+    size_t serialize(HistoryTier tier, char *out, size_t len) const;
+
+    static const char *tierName(HistoryTier tier);
+    static bool parseTier(const char *name, HistoryTier &tier);
+
+private:
+    struct Ring {
+        HistoryPoint *points;
+        uint8_t capacity;
+        uint8_t head;       // nächster Schreibplatz
+        uint8_t count;
+        uint32_t intervalS;
+    };
+
+    // Laufende Verdichtung für den nächsten Punkt einer Stufe
+    struct Accumulator {
+        uint32_t min[HISTORY_SERIES];
+        uint32_t max[HISTORY_SERIES];
+        uint32_t sum[HISTORY_SERIES];
+        uint16_t n[HISTORY_SERIES];
+        uint16_t samples;
+    };
+
+    HistoryPoint minutePoints[HISTORY_MINUTE_POINTS];
+    HistoryPoint hourPoints[HISTORY_HOUR_POINTS];
+    HistoryPoint dayPoints[HISTORY_DAY_POINTS];
+    Ring rings[(uint8_t)HistoryTier::COUNT] = {
+        {minutePoints, HISTORY_MINUTE_POINTS, 0, 0, 60},
+        {hourPoints, HISTORY_HOUR_POINTS, 0, 0, 3600},
+        {dayPoints, HISTORY_DAY_POINTS, 0, 0, 86400},
+    };
+    Accumulator acc[(uint8_t)HistoryTier::COUNT];
+
+    mutable portMUX_TYPE mux = portMUX_INITIALIZER_UNLOCKED;
+    unsigned long lastSample = 0;
+    uint8_t hoursSincePersist = 0;
+
+    void sample();
+    void addPoint(HistoryTier tier, const HistoryPoint &point);
+    HistoryPoint finish(Accumulator &a) const;
+    static void reset(Accumulator &a);
+    static void accumulate(Accumulator &a, uint8_t series, uint32_t lo, uint32_t avg, uint32_t hi);
+    void persist();
+};
+
+extern MetricHistory metricHistory;
@@ -0,0 +1,127 @@
+#pragma once
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include "config.h"
+
+// ============================================================
+// Laufzeit-Metriken für /metrics (Prometheus-Textformat)
+// - Erfassen kostet pro Ereignis nur ein paar Vergleiche unter einem
+//   Spinlock (Loop ~100 Hz, Display-Push, HTTP-Handler, Abrufe)
+// - Teure Werte (Heap, Stack-Reserven) werden erst beim Abruf gelesen
+// ============================================================
+
+#define METRICS_MAX_BUCKETS 10
+
+// Histogramm mit festen Obergrenzen (Prometheus "le"), Summe + Anzahl
+struct MetricsHistogram {
+    const uint32_t *bounds;
+    uint8_t boundCount;
+    uint32_t buckets[METRICS_MAX_BUCKETS + 1];  // letzter Eintrag = +Inf
+    uint64_t sum;
+    uint32_t count;
+
+    void observe(uint32_t value);
+};
+
+// HTTP-Routen mit eigener Latenz-Statistik
+enum class HttpRoute : uint8_t {
+    Root,
+    GetSettings,
+    SaveSettings,
+    Status,
+    Restart,
+    Reset,
+    Update,
+    UpdateStatus,
+    Metrics,
+    History,
+    Logs,
+    SetLogLevel,
+    Profile,
+    Diagnostics,
+    COUNT
+};
+
+// Netzwerkabrufe mit Dauer-Statistik
+enum class FetchSource : uint8_t {
+    Weather,
+    OtaCheck,   // version.txt / Prüfsumme
+    OtaImage,   // Firmware-Download inkl. Schreiben
+    COUNT
+};
+
+// Kennzahlen seit dem letzten takeWindow() (für den Verlauf, MetricHistory)
+struct MetricsWindow {
+    uint32_t loopAvgUs, loopMaxUs;
+    uint32_t pushAvgUs, pushMaxUs;
+    uint32_t pushCount;             // 0 → kein Frame im Fenster
+};
+
+// Zähler-Index für Frames, während DDP-Stream oder OTA das Panel belegen
+#define METRICS_MODE_OVERRIDE (DISPLAYMODES + 1)
+
+class Metrics {
+public:
+    Metrics();
+
+    // 🔁 Aktive Zeit einer loop()-Iteration (ohne Schlafen)
+    void observeLoop(uint32_t us);
+    // 🖥️ Display::update(): Hinausschieben + Latch, zählt den Frame zum aktuellen Modus
+    void observeDisplayPush(uint32_t us);
+    // Sekundentakt ohne Neuzeichnen (Panel belegt) → übersprungener Frame
+    void countSkippedFrame();
+    void setMode(uint8_t mode) { this->mode = mode; }
+    void setOverride(bool active) { panelOverride = active; }
+
+    void observeHttp(HttpRoute route, uint32_t us);
+#ifdef HEAP_PROBE
+    // Heap-Allokationen eines Handlers (heap_probe.h)
+    void observeHttpAllocations(HttpRoute route, uint32_t count);
+#endif
+    void observeFetch(FetchSource source, uint32_t ms, bool ok);
+
+    // Kurzlebige Tasks melden ihre Stack-Reserve vor dem Beenden selbst
+    void recordTaskStack(const char *name, uint32_t freeBytes);
+
+    // Mittel/Maximum seit dem letzten Aufruf, setzt das Fenster zurück (Haupt-Task)
+    MetricsWindow takeWindow();
+
+    // Kompletten Export in den Stream schreiben (AsyncTCP-Task)
+    void writePrometheus(Print &out);
+
+private:
+    static constexpr uint8_t MODE_SLOTS = METRICS_MODE_OVERRIDE + 1;
+    static constexpr uint8_t TRANSIENT_TASKS = 2;
+
+    mutable portMUX_TYPE mux = portMUX_INITIALIZER_UNLOCKED;
+
+    MetricsHistogram loopTime;
+    MetricsHistogram pushTime;
+    MetricsHistogram http[(uint8_t)HttpRoute::COUNT];
+#ifdef HEAP_PROBE
+    uint32_t httpAllocations[(uint8_t)HttpRoute::COUNT] = {0};
+    uint32_t httpAllocatingRequests[(uint8_t)HttpRoute::COUNT] = {0};
+#endif
+    MetricsHistogram fetch[(uint8_t)FetchSource::COUNT];
+    uint32_t fetchFailures[(uint8_t)FetchSource::COUNT] = {0};
+
+    // Fenster für takeWindow(): Stand von Summe/Anzahl beim letzten Aufruf
+    uint64_t windowLoopSum = 0, windowPushSum = 0;
+    uint32_t windowLoopCount = 0, windowPushCount = 0;
+    uint32_t windowLoopMax = 0, windowPushMax = 0;
+
+    uint32_t presented[MODE_SLOTS] = {0};
+    uint32_t skipped[MODE_SLOTS] = {0};
+    volatile uint8_t mode = 0;
+    volatile bool panelOverride = false;
+
+    const char *transientNames[TRANSIENT_TASKS] = {nullptr};
+    uint32_t transientStack[TRANSIENT_TASKS] = {0};
+
+    uint8_t frameSlot() const;
+    static void writeHistogram(Print &out, const char *name, const char *labels,
+                               const MetricsHistogram &h, uint32_t unitsPerSecond);
+};
+
+extern Metrics metrics;
@@ -0,0 +1,125 @@
+#pragma once
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <HTTPClient.h>
+#include <WiFiClientSecure.h>
+#include "config.h"
+
+// ============================================================
+// OTA-Dienst (ein Pfad für Button und Web-API)
+// - Versionscheck + Download in eigenem Task → Uhr, Button und
+//   Webserver bleiben bedienbar
+// - lädt bevorzugt firmware.bin.gz und entpackt beim Streamen,
+//   Rückfall auf firmware.bin
+// - SHA-256 des (entpackten) Images wird beim Streamen mitgerechnet
+//   und vor dem Aktivieren mit firmware.bin.sha256 verglichen
+// - App-Rollback: neues Image gilt erst nach gesundem Start als gültig,
+//   sonst bootet der Bootloader wieder die vorherige Firmware
+// ============================================================
+
+// Download-Blockgröße (statischer Puffer, nicht auf dem Task-Stack)
+#ifndef OTA_CHUNK_SIZE
+#define OTA_CHUNK_SIZE 4096
+#endif
+
+// Ringpuffer zum Entpacken von firmware.bin.gz; muss dem Kompressionsfenster
+// entsprechen (WINDOW_BITS in extra_scripts/compress_firmware.py, 2^12)
+#ifndef OTA_INFLATE_WINDOW
+#define OTA_INFLATE_WINDOW 4096
+#endif
+
+// Ohne Daten für diese Zeit → Abbruch
+#ifndef OTA_STALL_TIMEOUT_MS
+#define OTA_STALL_TIMEOUT_MS 15000UL
+#endif
+
+// Redirects (GitHub → CDN) werden selbst verfolgt, damit jede Verbindung
+// ihrem Host zugeordnet bleibt und im HTTPS-Pool wiederverwendet wird
+#ifndef OTA_MAX_REDIRECTS
+#define OTA_MAX_REDIRECTS 3
+#endif
+
+// Neues Image gilt als gesund, wenn der Haupt-loop so lange läuft und das
+// Panel dabei mindestens jeden zweiten Sekundentakt ausgibt. WLAN ist keine
+// Bedingung: Router aus oder Portal offen ist kein Fehler der Firmware
+#ifndef OTA_HEALTHY_AFTER_MS
+#define OTA_HEALTHY_AFTER_MS 60000UL
+#endif
+#define OTA_HEALTHY_MIN_FRAMES (OTA_HEALTHY_AFTER_MS / 2000)
+
+// Ab dem ersten loop() gemessen (Setup inkl. WLAN-Portal zählt nicht);
+// bis dahin nicht gesund → Rollback auf die vorherige Firmware.
+// Hänger und Abstürze davor rollt schon der Bootloader zurück
+#ifndef OTA_ROLLBACK_TIMEOUT_MS
+#define OTA_ROLLBACK_TIMEOUT_MS (5UL * 60000UL)
+#endif
+
+enum class OtaState : uint8_t {
+    Idle,
+    Checking,       // version.txt / Prüfsumme laden
+    Downloading,
+    Verifying,
+    UpToDate,
+    Success,        // Neustart folgt
+    Failed
+};
+
+struct OtaStatus {
+    OtaState state;
+    uint32_t downloaded;        // übertragene Bytes (ggf. komprimiert)
+    uint32_t total;             // Content-Length des Downloads
+    uint32_t imageBytes;        // in die OTA-Partition geschrieben
+    uint32_t durationMs;        // Gesamtdauer inkl. Versionscheck
+    bool compressed;
+    unsigned long finishedAt;   // millis() bei UpToDate/Success/Failed
+    char version[24];           // Online-Version
+    char message[48];           // Fehlertext
+};
+
+class OtaService {
+public:
+    // Beim Start aufrufen: meldet, ob das laufende Image noch bestätigt werden muss
+    void begin();
+
+    // Update im Hintergrund starten (false, wenn bereits eines läuft)
+    bool start();
+
+    // Im Haupt-loop: Image bestätigen/zurückrollen, nach Erfolg neu starten
+    void loop();
+
+    bool isBusy() const;
+    OtaStatus getStatus() const;
+    uint8_t getPercent() const;
+    bool isPendingVerify() const { return pendingVerify; }
+
+    static const char* stateName(OtaState state);
+
+private:
+    TaskHandle_t task = nullptr;
+    OtaStatus status = {};
+    mutable portMUX_TYPE statusMux = portMUX_INITIALIZER_UNLOCKED;
+    bool pendingVerify = false;
+    bool verifying = false;         // Messung im Haupt-loop läuft
+    unsigned long verifyStart = 0;
+    uint32_t verifyFrames = 0;      // Display-Zähler beim Start der Messung
+
+    static void taskEntry(void *arg);
+    void run();
+    // Nur im OTA-Task, über alle Abrufe eines Laufs: ~HTTPClient() schließt
+    // seinen letzten Client, auch einen im Pool behaltenen
+    WiFiClient plain;   // http:// (lokaler Ersatz-Server)
+    HTTPClient http;
+
+    // GET über den HTTPS-Pool bzw. plain; secure muss danach mit httpsPool.release() zurück
+    int get(WiFiClientSecure *&secure, const char *url);
+    bool fetchText(const char *url, char *out, size_t len);
+    // nullptr bei Erfolg, sonst Fehlertext
+    const char *download(const char *url, const char *expectedSha, bool gzip);
+
+    void setState(OtaState state, const char *message = nullptr);
+    void setProgress(uint32_t downloaded, uint32_t total, uint32_t imageBytes);
+};
+
+extern OtaService otaService;
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <Arduino.h>
+#include <atomic>
+#include <esp_idf_version.h>
+#include <esp_timer.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+
+// ============================================================
+// Panel-Helligkeit über die LEDC-Hardware (OE-Pin, low-aktiv)
+// - LEDC wird einmal in begin() eingerichtet, danach ändert sich nur
+//   noch der Duty-Wert
+// - Stufen 0–255 sind wahrnehmungslinear (Gamma), die PWM hat 10 Bit,
+//   damit auch die dunklen Stufen fein aufgelöst bleiben
+// - Übergänge übernimmt die Fade-Einheit der LEDC: ein Übergang wird in
+//   wenige Teilstücke entlang der Gammakurve zerlegt, jedes blendet die
+//   Hardware selbst; ein esp_timer stößt nur das nächste Teilstück an
+// - der esp_timer wartet nie: ist der Lock belegt (ein Task wartet z. B.
+//   unter IDF 4.x auf das Ende eines Hardware-Fades), übernimmt loop()
+//   im Haupt-Task das Teilstück (Task-Benachrichtigung wie beim Sekundentakt)
+// - Effekt-Helligkeit (show/flash) ist vorübergehend, danach geht es
+//   automatisch zur globalen Helligkeit zurück
+// ============================================================
+
+#define DIMMER_LEDC_CHANNEL 0
+#define DIMMER_LEDC_TIMER 0
+#define DIMMER_PWM_FREQ 5000
+#define DIMMER_PWM_BITS 10
+#define DIMMER_GAMMA 2.2f
+#define DIMMER_SEGMENT_MS 20        // kürzestes Teilstück eines Übergangs
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 0, 0)
+#define DIMMER_MAX_SEGMENTS 8
+#else
+// IDF 4.x kann einen Hardware-Fade nicht anhalten, jeder Schreibzugriff wartet
+// das laufende Teilstück ab → kürzere Teilstücke, damit setLimit() schnell greift
+#define DIMMER_MAX_SEGMENTS 32
+#endif
+#define DIMMER_RESTORE_MS 150       // Rückweg nach einem Effekt
+
+class PanelDimmer {
+public:
+    // LEDC-Timer, -Kanal und Fade-Einheit einrichten (einmalig, im Haupt-Task:
+    // der aufrufende Task bekommt die Teilstücke, die der esp_timer abgibt)
+    void begin(uint8_t pin, uint8_t level);
+    // Im Haupt-loop: vom esp_timer abgegebenes Teilstück fortsetzen
+    void loop();
+
+    // 🔆 Globale Helligkeit (Einstellung)
+    void set(uint8_t level);
+    void fadeTo(uint8_t level, uint16_t ms);
+    uint8_t getLevel() const { return level; }
+
+    // ✨ Vorübergehend für Effekte
+    void show(uint8_t level);                             // sofort, bis restore()
+    void flash(uint8_t from, uint8_t to, uint16_t ms);    // from → to, danach zurück
+    void restore(uint16_t ms = DIMMER_RESTORE_MS);
+
+    // ⚡ Obergrenze für jede ausgegebene Stufe (Strombudget, siehe PowerGovernor).
+    // Senken greift sofort, auch mitten in einem Übergang (vor dem nächsten Latch);
+    // Lockern blendet über ms, während eines Übergangs ab dessen nächstem Teilstück
+    void setLimit(uint8_t cap, uint16_t ms);
+    uint8_t getLimit() const { return limit; }
+    // Tatsächlich angesteuerte Stufe (inkl. Effekt und Grenze)
+    uint8_t getEffective() const { return min(output, limit); }
+    bool isLimited() const { return output > limit; }
+
+    // Stufe → Duty am OE-Pin (invertiert: voller Duty = dunkel)
+    static uint32_t duty(uint8_t level);
+    // Stufe → Einschaltanteil der LEDs (0..1)
+    static float onFraction(uint8_t level);
+
+private:
+    struct Fade {
+        uint8_t from, to;
+        uint8_t segments, segment;
+        uint16_t segmentMs;
+        bool restoreAfter;
+        int64_t segmentEndUs;
+    };
+
+    uint8_t level = 0;           // global
+    uint8_t output = 0;          // zuletzt an die Hardware gegebene Stufe (vor der Grenze)
+    uint8_t limit = 255;
+    Fade fade = {};
+    bool fading = false;
+    esp_timer_handle_t timer = nullptr;
+    SemaphoreHandle_t lock = nullptr;   // Haupt-Task, Wetter-Task, esp_timer (nur ohne Warten)
+    TaskHandle_t owner = nullptr;       // übernimmt Teilstücke, wenn der Lock belegt war
+    std::atomic<bool> segmentDue{false};
+
+    void cancel();
+    void writeNow(uint8_t value);
+    void writeCapped();
+    void startFade(uint8_t from, uint8_t to, uint16_t ms, bool restoreAfter);
+    void startSegment();
+    void advance();
+    static void onTimer(void *arg);
+};
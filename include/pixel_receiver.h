@@ -0,0 +1,71 @@
+#pragma once
+
+#include <Arduino.h>
+#include <AsyncUDP.h>
+#include <atomic>
+#include "config.h"
+
+// ============================================================
+// Echtzeit-Pixelempfang per UDP (DDP, Port 4048)
+// - akzeptiert 1 bpp (32 Byte gepackt), 8-Bit-Graustufen (256 Byte)
+//   und 8-Bit-RGB (768 Byte); Helligkeit ≥ 128 → Pixel an
+// - Pakete werden direkt im UDP-Task in einen 32-Byte-Frame dekodiert,
+//   Übergabe an den Haupt-Task per Dreifachpuffer (kein Lock, keine Kopie)
+// - übernimmt das Panel, solange Frames kommen; nach DDP_TIMEOUT_MS
+//   ohne Paket zurück zum eingestellten Modus
+// ============================================================
+
+// Gepackter 1-bpp-Frame: Zeile für Zeile, 2 Byte pro Zeile, MSB = linkes Pixel
+#define PIXEL_FRAME_BYTES (DISPLAY_WIDTH * DISPLAY_HEIGHT / 8)
+
+class PixelReceiver {
+public:
+    void begin(uint16_t port = DDP_PORT);
+
+    // Im Haupt-loop aufrufen: zeigt den neuesten Frame an.
+    // false, solange kein Stream aktiv ist (normale Anzeige läuft weiter).
+    bool update();
+    bool isActive() const { return active; }
+
+    // 📊 Statistik
+    uint32_t getFrames() const { return frames; }       // vollständig empfangene Frames
+    uint32_t getDropped() const { return dropped; }     // Lücken in der DDP-Sequenznummer
+    uint32_t getSkipped() const { return skipped; }     // überholt, bevor sie angezeigt wurden
+    uint16_t getFps() const { return fps; }
+
+private:
+    // DDP-Header (10 Byte, +4 mit Timecode)
+    static constexpr uint8_t DDP_FLAG_VER1 = 0x40;
+    static constexpr uint8_t DDP_FLAG_TIMECODE = 0x10;
+    static constexpr uint8_t DDP_FLAG_QUERY = 0x02;
+    static constexpr uint8_t DDP_FLAG_PUSH = 0x01;
+    static constexpr uint8_t DDP_HEADER_LEN = 10;
+
+    AsyncUDP udp;
+
+    // Dreifachpuffer: UDP-Task schreibt back, Haupt-Task liest front,
+    // middle wird atomar getauscht (Bit FRAME_NEW = ungelesener Frame)
+    static constexpr uint8_t FRAME_NEW = 0x80;
+    uint8_t buffers[3][PIXEL_FRAME_BYTES] = {{0}};
+    uint8_t back = 0;
+    uint8_t front = 1;
+    std::atomic<uint8_t> middle{2};
+
+    std::atomic<uint32_t> lastPacketMs{0};
+    uint8_t lastSeq = 0;
+    uint32_t frames = 0;
+    uint32_t dropped = 0;
+    uint32_t skipped = 0;
+
+    // Nur Haupt-Task
+    bool active = false;
+    uint16_t fps = 0;
+    uint16_t framesThisSecond = 0;
+    unsigned long fpsWindowStart = 0;
+
+    void onPacket(AsyncUDPPacket &packet);
+    bool decode(const uint8_t *data, size_t len, uint32_t offset, uint8_t dataType);
+    void publish();
+};
+
+extern PixelReceiver pixelReceiver;
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <Arduino.h>
+#include <atomic>
+#include "config.h"
+#include "panel_dimmer.h"
+
+// ============================================================
+// Strombudget-Begrenzer
+// - zählt pro ausgegebenem Frame die leuchtenden Pixel (popcount über
+//   den gepackten 1-bpp-Frame) und schätzt mit dem PWM-Einschaltanteil
+//   den Strom: Grundlast + Pixel × Strom je LED × Einschaltanteil
+// - liegt die Schätzung über POWER_BUDGET_MA (config.h), bekommt der
+//   Dimmer eine Obergrenze: sofort vor dem Latch herunter, langsam
+//   (POWER_RELEASE_MS) wieder hinauf
+// - Schätzung und Grenze als Metriken unter /metrics
+// ============================================================
+
+#ifndef POWER_BUDGET_MA
+#define POWER_BUDGET_MA 1000
+#endif
+#ifndef POWER_IDLE_MA
+#define POWER_IDLE_MA 120            // ESP32 mit WLAN, Treiber-ICs
+#endif
+#ifndef POWER_LED_MA
+#define POWER_LED_MA 8               // eine LED bei 100 % Einschaltanteil
+#endif
+#define POWER_RELEASE_MS 1000
+#define POWER_RELEASE_STEP 4         // kleinere Lockerungen ignorieren (kein Flackern)
+
+class PowerGovernor {
+public:
+    // Aus Display::update() zwischen Hinausschieben und Latch
+    void onFrame(const uint8_t frame[32], PanelDimmer &dimmer);
+
+    uint16_t getLitPixels() const { return lit.load(); }
+    uint8_t getLimit() const { return dimmer ? dimmer->getLimit() : 255; }
+    uint32_t getLimitedFrames() const { return limitedFrames.load(); }
+    // Aktuelle Schätzung (berücksichtigt auch Übergänge seit dem letzten Frame)
+    uint32_t getEstimatedMa() const;
+
+    static uint8_t capFor(uint16_t litPixels);
+    static uint32_t estimateMa(uint16_t litPixels, uint8_t level);
+
+private:
+    std::atomic<uint16_t> lit{0};
+    std::atomic<uint32_t> limitedFrames{0};
+    const PanelDimmer *dimmer = nullptr;
+};
+
+extern PowerGovernor powerGovernor;
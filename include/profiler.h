@@ -0,0 +1,98 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <atomic>
+
+// ============================================================
+// Profiling-Zonen über den CPU-Zykluszähler
+// - PROFILE_ZONE("name") misst bis zum Ende des Blocks, verschachtelte
+//   Zonen bilden pro Task einen Aufrufbaum (feste Knotentabelle)
+// - Export als "folded stacks" (task;zone;zone Zyklen) für flamegraph.pl
+//   bzw. speedscope: GET /api/profile
+// - nur mit -D PROFILING aktiv, sonst verschwinden die Makros komplett
+// - ohne Arduino (Host-Build) zählt __rdtsc() bzw. steady_clock, damit
+//   Profile auf Gerät und PC vergleichbar bleiben
+// ============================================================
+
+#ifndef PROFILE_MAX_NODES
+#define PROFILE_MAX_NODES 128
+#endif
+#ifndef PROFILE_MAX_DEPTH
+#define PROFILE_MAX_DEPTH 12
+#endif
+
+#ifdef PROFILING
+
+#if defined(ARDUINO) || defined(ESP_PLATFORM)
+#include <xtensa/hal.h>
+static inline uint32_t profileCycles() { return xthal_get_ccount(); }
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+static inline uint32_t profileCycles() { return (uint32_t)__rdtsc(); }
+#else
+#include <chrono>
+static inline uint32_t profileCycles() {
+    return (uint32_t)std::chrono::steady_clock::now().time_since_epoch().count();
+}
+#endif
+
+class Profiler {
+public:
+    Profiler();
+
+    // Zone betreten/verlassen (über ProfileZone, nicht direkt aufrufen)
+    void enter(const char *name);
+    void leave(uint32_t elapsed);
+
+    // Folded Stacks mit Selbst-Zeit in Zyklen; Länge ohne Nullterminator
+    size_t writeFolded(char *out, size_t len) const;
+    // Zähler nullen (Baumstruktur bleibt, damit laufende Zonen gültig sind)
+    void reset();
+    uint16_t getNodeCount() const { return nodeCount.load(); }
+    uint32_t getOverflows() const { return overflows.load(); }
+
+private:
+    struct Node {
+        const char *name;
+        int16_t parent;
+        std::atomic<int16_t> firstChild;
+        int16_t nextSibling;
+        uint64_t cycles;      // inklusive Kinder
+        uint32_t calls;
+    };
+
+    Node nodes[PROFILE_MAX_NODES];
+    std::atomic<uint16_t> nodeCount{0};
+    std::atomic<uint32_t> overflows{0};   // Tabelle voll / zu tief verschachtelt
+
+    int16_t findOrAdd(int16_t parent, const char *name);
+    int16_t taskRoot();
+};
+
+extern Profiler profiler;
+
+// Misst vom Konstruktor bis zum Destruktor
+class ProfileZone {
+public:
+    explicit ProfileZone(const char *name) {
+        profiler.enter(name);
+        start = profileCycles();
+    }
+    ~ProfileZone() { profiler.leave(profileCycles() - start); }
+
+private:
+    uint32_t start;
+};
+
+#define PROFILE_CONCAT_(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_(a, b)
+#define PROFILE_ZONE(name) ProfileZone PROFILE_CONCAT(profileZone, __LINE__)(name)
+#define PROFILE_FUNCTION() PROFILE_ZONE(__func__)
+
+#else
+
+#define PROFILE_ZONE(name) ((void)0)
+#define PROFILE_FUNCTION() ((void)0)
+
+#endif
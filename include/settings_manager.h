@@ -2,13 +2,27 @@
 
 #include <Arduino.h>
 #include <EEPROM.h>
+#include <Preferences.h>
+#include <atomic>
+#include <freertos/FreeRTOS.h>
 #include "config.h"
 
-// EEPROM-Konfiguration
+// Alte EEPROM-Konfiguration (nur noch für einmalige Migration nach NVS)
 #define EEPROM_MAGIC 0x42AF
 #define EEPROM_VERSION 2
 #define EEPROM_ADDR 0
 #define EEPROM_SIZE 64
+// In der EEPROM-Firmware war 9 der letzte Modus ("Display aus")
+#define EEPROM_MODE_OFF 9
+
+// NVS-Namespace und Version des Schlüssel-Layouts
+#define SETTINGS_NVS_NAMESPACE "settings"
+#define SETTINGS_NVS_VERSION 1
+
+// Änderungen erst nach dieser Ruhezeit in den Flash schreiben
+#ifndef SETTINGS_FLUSH_DELAY_MS
+#define SETTINGS_FLUSH_DELAY_MS 2000
+#endif
 
 // Speichergrenze für Stadtnamen (inkl. Nullterminator)
 #ifndef CITY_MAX_LEN
@@ -35,9 +49,25 @@ public:
 
     bool begin();
     void load();
-    void save();
+    void save();       // sofort alle geänderten Werte schreiben
     void reset();
 
+    // Verzögertes Schreiben: in loop() aufrufen
+    void loop();
+    // Ausstehende Änderungen sofort schreiben (z. B. vor Neustart)
+    void flush();
+    bool isDirty() const { return dirtyMask != 0; }
+
+    // 📊 Flash-Verschleiß
+    uint32_t getFlashWrites() const { return flashWrites; }    // geschriebene Schlüssel (gesamt)
+    uint32_t getFlushCount() const { return flushCount; }      // Flush-Vorgänge (gesamt)
+
+    // 🔒 Lock-freier Lesezugriff (Seqlock) für alle Tasks/Kerne
+    // Konsistente Kopie aller Einstellungen
+    Settings snapshot() const;
+    // Wird bei jeder Änderung erhöht → Polling nur bei neuer Version
+    uint32_t getVersion() const { return seq.load(std::memory_order_acquire) >> 1; }
+
     // Getter / Setter
     uint8_t getBrightness();
     void setBrightness(uint8_t value);
@@ -50,11 +80,39 @@ public:
 
     // Wetter: Stadt (Persistenz)
     String getCity();
-    void setCity(const String& city);
+    // Ohne Allokation (Leerraum am Rand wird entfernt); true = geändert
+    bool setCity(const char* city);
+    void setCity(const String& city) { setCity(city.c_str()); }
 
 private:
+    // Bits für geänderte Felder
+    enum : uint8_t {
+        DIRTY_BRIGHTNESS = 1 << 0,
+        DIRTY_MODE       = 1 << 1,
+        DIRTY_AUTOSYNC   = 1 << 2,
+        DIRTY_CITY       = 1 << 3,
+        DIRTY_ALL        = 0x0F
+    };
+
+    // Veröffentlichte Einstellungen; Schreiber serialisiert über writeMux,
+    // seq ungerade = Schreibvorgang läuft
     Settings settings;
+    std::atomic<uint32_t> seq{0};
+    portMUX_TYPE writeMux = portMUX_INITIALIZER_UNLOCKED;
+
+    Preferences prefs;
+    bool prefsOpen = false;
+    uint8_t dirtyMask = 0;
+    unsigned long lastChange = 0;
+    uint32_t flashWrites = 0;
+    uint32_t flushCount = 0;
+
     bool validate();   // nur intern
+    void markDirty(uint8_t bits);
+    void beginWrite();
+    // changed = false: alte Version wiederherstellen (getVersion() bleibt gleich)
+    void endWrite(bool changed = true);
+    bool migrateFromEEPROM();
 };
 
 extern SettingsManager settingsManager;
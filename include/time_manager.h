@@ -3,6 +3,31 @@
 
 #include <Arduino.h>
 #include <time.h>
+#include <sys/time.h>
+#include <esp_timer.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+// Abstand der SNTP-Abfragen (Sommer/Winterzeit kommt aus der TZ-Regel)
+// Startwert; wird bei kleiner Abweichung adaptiv bis NTP_SYNC_MAX_INTERVAL_MS verdoppelt
+#ifndef NTP_SYNC_INTERVAL_MS
+#define NTP_SYNC_INTERVAL_MS 3600000UL
+#endif
+
+#ifndef NTP_SYNC_MAX_INTERVAL_MS
+#define NTP_SYNC_MAX_INTERVAL_MS (12UL * 3600000UL)
+#endif
+
+// Größere Abweichungen springen sofort (settimeofday), kleinere werden per
+// adjtime nachgeführt (1/64 Tempo → 1 s in gut einer Minute)
+#ifndef NTP_STEP_THRESHOLD_MS
+#define NTP_STEP_THRESHOLD_MS 1000
+#endif
+
+// Laufende Zeit so oft in NVS sichern (Startwert nach Stromausfall)
+#ifndef TIME_SAVE_INTERVAL_MS
+#define TIME_SAVE_INTERVAL_MS (10UL * 60000UL)
+#endif
 
 class TimeManager {
 public:
@@ -18,15 +43,65 @@ public:
     uint16_t getYear();
     
     bool isSynced();
+    bool isValid();                   // synchronisiert oder aus RTC/NVS fortgeführt
     String getTimeString();
     String getDateString();
+
+    // ⏱️ SNTP-Status
+    int32_t getSyncOffsetMs();        // Korrektur beim letzten Sync (Server − lokal)
+    uint32_t getSecondsSinceSync();   // monoton (esp_timer), UINT32_MAX = nie
+    uint32_t getSyncCount();
+
+    // 🪫 Offline-Gangkorrektur (über Neustarts gelernt)
+    int32_t getDriftPpb();            // + = Quarz läuft vor
+    uint32_t getSyncIntervalMs();
+
+    // 🔔 Sekundentakt: esp_timer feuert auf jeder echten Sekundengrenze
+    void startSecondTick(TaskHandle_t notifyTask);
+    bool takeSecondTick();            // true genau einmal pro neuer Sekunde
+    void markFrameLatched();          // Versatz Sekundengrenze → Frame messen
+    uint32_t getFrameSkewUs();        // letzter Versatz
+    uint32_t getMaxFrameSkewUs();     // größter Versatz seit Start
+
+    // Neue SNTP-Zeit übernehmen (nur aus sntp_sync_time(), lwIP-Task)
+    void onTimeSync(struct timeval *tv);
     
 private:
     struct tm timeinfo;
-    bool synced;
-    unsigned long lastSync;
-    
-    bool syncTime();
+    time_t cachedEpoch;
+
+    // Vom SNTP-Callback (lwIP-Task) geschrieben
+    volatile bool synced;
+    volatile int64_t lastSyncUs;      // esp_timer_get_time() beim letzten Sync
+    volatile int32_t syncOffsetMs;
+    volatile uint32_t syncCount;
+
+    // Sekundentakt
+    esp_timer_handle_t secondTimer;
+    TaskHandle_t tickTask;
+    volatile bool tickPending;
+    uint32_t frameSkewUs;
+    uint32_t maxFrameSkewUs;
+
+    // Gangabweichung / Persistenz
+    volatile int32_t driftPpb;
+    volatile uint32_t syncIntervalMs;
+    volatile bool calibrationDirty;
+    int64_t lastDriftCorrUs;
+    double driftCarryUs;
+
+    // Kaltstart: Zeit nur aus NVS geschätzt → erster Sync springt
+    volatile bool estimated;
+    int64_t lastEpochSaveUs;
+
+    void restoreTime();
+    void saveCalibration();
+    void saveEpoch();
+    void applyDriftCorrection();
+    void calibrate(int64_t offsetUs, int64_t nowUs);
+
+    static void onSecondTimer(void *arg);
+    void armSecondTimer();
 };
 
 extern TimeManager timeManager;
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <Arduino.h>
+
+// ============================================================
+// Wetterbedingung als kompakter Code
+// - wird einmal beim Abruf aus dem numerischen Anbieter-Code gebildet
+//   (WeatherProvider::mapCode)
+// - indiziert direkt die Icon-Tabelle in display.cpp
+// ============================================================
+enum class WeatherCondition : uint8_t {
+    Unknown = 0,
+    Clear,
+    Cloud,
+    Rain,
+    Snow,
+    Thunder,
+    Fog,
+    COUNT
+};
+
+// Kurzname für Logs/API (statischer String, keine Allokation)
+const char* weatherConditionName(WeatherCondition cond);
@@ -4,22 +4,88 @@
 #include <Arduino.h>
 #include <HTTPClient.h>
 #include <ArduinoJson.h>
+#include "weather_condition.h"
+#include <atomic>
+
+// Anzahl Vorhersage-Slots (wttr.in liefert 3h-Raster → 16 Slots = 48h,
+// eine Spalte pro Slot auf dem 16x16-Panel)
+#define FORECAST_SLOTS 16
+
+// Ein Vorhersage-Slot (3 Byte)
+struct HourlyForecast {
+    int8_t temp;                  // °C
+    uint8_t precip;               // Regenwahrscheinlichkeit 0–100 %
+    WeatherCondition condition;
+};
+
+// Fester Ringpuffer für die stündliche Vorhersage
+class ForecastBuffer {
+public:
+    void clear() { head = 0; count = 0; }
+    void push(const HourlyForecast& f) {
+        slots[(head + count) % FORECAST_SLOTS] = f;
+        if (count < FORECAST_SLOTS) count++;
+        else head = (head + 1) % FORECAST_SLOTS;
+    }
+    bool full() const { return count == FORECAST_SLOTS; }
+    uint8_t size() const { return count; }
+    // i = 0 → nächster Slot ab jetzt
+    const HourlyForecast& at(uint8_t i) const { return slots[(head + i) % FORECAST_SLOTS]; }
+
+private:
+    HourlyForecast slots[FORECAST_SLOTS];
+    uint8_t head = 0;
+    uint8_t count = 0;
+};
+
+class WeatherProvider;
 
 class WeatherManager {
 public:
     void begin(const String& city);
     void update(const bool withoutCheckmark = false);
+    // Abruf in eigenem Task (blockiert weder loop() noch Webserver).
+    // false, wenn bereits ein Abruf läuft.
+    bool updateAsync(const bool withoutCheckmark = true);
+    bool isUpdating() const { return updating.load(); }
     void setCity(const String& city);
     String getCity() const;
+    void setProvider(WeatherProvider& provider);
 
     float getTemperature() const;
-    String getCondition() const;
+    WeatherCondition getCondition() const;
+
+    // 📈 Vorhersage (einmal pro Abruf im WeatherUpdateTask vorberechnet)
+    bool hasForecast() const;
+    // Spalten-Bitmasken (Bit y = Pixel in Zeile y) für Display::drawColumns()
+    // nach out[FORECAST_SLOTS] kopieren: Regenbalken oder Temperatur-Sparkline.
+    // false, solange keine Vorhersage vorliegt.
+    bool copyForecastColumns(uint16_t* out, bool precip) const;
+    int8_t getForecastMin() const;
+    int8_t getForecastMax() const;
 
 private:
     String city;
     float temperature = 0.0;
-    String condition = "N/A";
+    WeatherCondition condition = WeatherCondition::Unknown;
     unsigned long lastUpdate = 0;
+    WeatherProvider* provider = nullptr;
+    std::atomic<bool> updating{false};
+    bool asyncWithoutCheckmark = true;
+
+    // Fertig berechnete Vorhersage; Abruf-Task schreibt, Haupt-Task liest
+    // → nur als Ganzes unter forecastMux kopieren
+    struct ForecastColumns {
+        uint16_t sparkline[FORECAST_SLOTS];
+        uint16_t precipBars[FORECAST_SLOTS];
+        int8_t min;
+        int8_t max;
+        uint8_t slots;
+    };
+    ForecastColumns columns = {};
+    mutable portMUX_TYPE forecastMux = portMUX_INITIALIZER_UNLOCKED;
+
+    static void buildForecastColumns(const ForecastBuffer& forecast, ForecastColumns& out);
 };
 
 extern WeatherManager weatherManager;
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <functional>
+#include "weather_condition.h"
+#include "weather_manager.h"
+
+// ============================================================
+// Wetter-Anbieter
+// - URL-Aufbau, Streaming-Parse und Code → WeatherCondition
+// - Basis-URLs über config.h überschreibbar (z. B. lokaler Test-Server)
+// ============================================================
+
+// Ergebnis eines Abrufs (wird vom WeatherManager übernommen)
+struct WeatherReport {
+    float temperature = 0.0f;
+    WeatherCondition condition = WeatherCondition::Unknown;
+    ForecastBuffer forecast;
+};
+
+class WeatherProvider {
+public:
+    virtual ~WeatherProvider() {}
+
+    virtual const char* name() const = 0;
+
+    // Vorbereitung pro Stadt (z. B. Geocoding), Ergebnis wird gecacht
+    virtual bool resolve(const String& city) { return true; }
+
+    virtual String buildUrl(const String& city) const = 0;
+
+    // Parst direkt aus dem HTTP-Stream, ohne Payload-String
+    virtual bool parse(Stream& body, WeatherReport& out) = 0;
+
+    // Numerischer Anbieter-Code → WeatherCondition
+    virtual WeatherCondition mapCode(uint16_t code) const = 0;
+};
+
+// wttr.in ?format=j1 (groß, aber ohne Geocoding)
+class WttrJsonProvider : public WeatherProvider {
+public:
+    const char* name() const override { return "wttr.in"; }
+    String buildUrl(const String& city) const override;
+    bool parse(Stream& body, WeatherReport& out) override;
+    WeatherCondition mapCode(uint16_t code) const override;
+};
+
+// Open-Meteo: nur aktuelle Werte + 48h stündlich (~1 KB)
+class OpenMeteoProvider : public WeatherProvider {
+public:
+    const char* name() const override { return "open-meteo"; }
+    bool resolve(const String& city) override;
+    String buildUrl(const String& city) const override;
+    bool parse(Stream& body, WeatherReport& out) override;
+    WeatherCondition mapCode(uint16_t code) const override;
+
+private:
+    String resolvedCity;
+    float latitude = 0.0f;
+    float longitude = 0.0f;
+};
+
+// GET auf url, bei 200 wird der Body-Stream an parse übergeben.
+// http:// (z. B. lokaler Test-Server) und https:// werden unterstützt.
+bool weatherHttpGet(const String& url, std::function<bool(Stream&)> parse);
+
+// Anbieter gemäß config.h (WEATHER_PROVIDER_OPEN_METEO)
+WeatherProvider& defaultWeatherProvider();
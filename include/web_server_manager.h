@@ -3,27 +3,109 @@
 
 #include <Arduino.h>
 #include <WiFi.h>
-#include <WebServer.h>
+#include <ESPAsyncWebServer.h>
+#include <ArduinoJson.h>
+#include <atomic>
+#include "metrics.h"
 
+// Anzahl Handler-Laufzeiten für p50/p99 in /api/status
+#define HTTP_LATENCY_SAMPLES 64
+
+// Antwortpuffer für /api/history (Minutenstufe ≈ 6 KB)
+#define HISTORY_JSON_BUFFER 8192
+
+// Antwortpuffer für /api/logs; passen nicht alle LOG_HISTORY_SIZE Einträge
+// hinein, endet die Seite vorher ("more":true, weiter mit ?since=<next>)
+#define LOGS_JSON_BUFFER 8192
+// Platz für einen Eintrag im ungünstigsten Fall (jedes Zeichen als \u00XX) + Abschluss
+#define LOGS_ENTRY_RESERVE (LOG_LINE_LEN * 6 + 128)
+
+// Antwortpuffer für /api/profile (Folded Stacks, nur mit -D PROFILING)
+#define PROFILE_TEXT_BUFFER 8192
+
+// Antwortpuffer für /api/diagnostics (DIAG_EVENT_COUNT Ereignisse)
+#define DIAG_JSON_BUFFER 6144
+
+// Gemeinsamer statischer Puffer der großen Antworten oben (eine zur Zeit)
+#define LARGE_RESPONSE_BUFFER 8192
+static_assert(HISTORY_JSON_BUFFER <= LARGE_RESPONSE_BUFFER && LOGS_JSON_BUFFER <= LARGE_RESPONSE_BUFFER &&
+              PROFILE_TEXT_BUFFER <= LARGE_RESPONSE_BUFFER && DIAG_JSON_BUFFER <= LARGE_RESPONSE_BUFFER,
+              "Antwortpuffer größer als LARGE_RESPONSE_BUFFER");
+
+// Live-Status über WebSocket (/ws): Prüfintervall für Änderungen
+#define WS_PUSH_INTERVAL_MS 250
+
+// ============================================================
+// Asynchroner Webserver (läuft im AsyncTCP-Task auf Core 0)
+// - Handler blockieren nie: Neustart, WLAN-Reset und Wetter-Abruf
+//   werden nur vorgemerkt und in loop() auf dem Haupt-Task ausgeführt,
+//   OTA läuft im eigenen Task (OtaService)
+// ============================================================
 class WebServerManager {
 public:
     WebServerManager();
     void begin();
-    void handleClient();
-    
+    // Vorgemerkte Aktionen ausführen und Live-Status pushen (aus dem Haupt-loop aufrufen)
+    void loop();
+
+    // 📊 Handler-Laufzeit in µs (über die letzten HTTP_LATENCY_SAMPLES Anfragen)
+    uint32_t getLatencyPercentileUs(uint8_t percentile) const;
+
 private:
-    WebServer server;
-    
-    void handleRoot();
-    void handleGetSettings();
-    void handleSaveSettings();
-    void handleStatus();
-    void handleRestart();
-    void handleReset();
-    void handleNotFound();
-    void handleOTAUpdate();
-    
-    String getHTML();
+    enum PendingAction : uint8_t {
+        ACTION_NONE = 0,
+        ACTION_WEATHER = 1 << 0,
+        ACTION_RESTART = 1 << 1,
+        ACTION_RESET = 1 << 2,
+    };
+
+    // Per WebSocket übertragener Zustand (nur geänderte Felder werden gesendet)
+    struct LiveStatus {
+        uint8_t hour, minute, second;
+        int8_t rssi;
+        uint8_t mode;
+        uint8_t brightness;
+        int16_t tempTenths;        // °C × 10
+        uint8_t condition;
+    };
+
+    AsyncWebServer server;
+    AsyncWebSocket ws;
+    bool fsAssets = false;             // Startseite + /assets/ aus LittleFS
+    std::atomic<uint8_t> pending{ACTION_NONE};
+    std::atomic<bool> wsResync{false};   // neuer Client → nächster Push vollständig
+    LiveStatus lastPushed = {};
+    unsigned long lastPush = 0;
+    unsigned long lastWsCleanup = 0;
+    unsigned long actionDueAt = 0;
+
+    uint32_t latencies[HTTP_LATENCY_SAMPLES] = {0};
+    uint8_t latencyCount = 0;
+    uint8_t latencyHead = 0;
+
+    void handleRoot(AsyncWebServerRequest *request);
+    void handleGetSettings(AsyncWebServerRequest *request);
+    void handleSaveSettings(AsyncWebServerRequest *request, JsonVariant &json);
+    void handleStatus(AsyncWebServerRequest *request);
+    void handleRestart(AsyncWebServerRequest *request);
+    void handleReset(AsyncWebServerRequest *request);
+    void handleNotFound(AsyncWebServerRequest *request);
+    void handleOTAUpdate(AsyncWebServerRequest *request);
+    void handleOTAStatus(AsyncWebServerRequest *request);
+    void handleMetrics(AsyncWebServerRequest *request);
+    void handleHistory(AsyncWebServerRequest *request);
+    void handleLogs(AsyncWebServerRequest *request);
+    void handleLogLevel(AsyncWebServerRequest *request, JsonVariant &json);
+    void handleProfile(AsyncWebServerRequest *request);
+    void handleDiagnostics(AsyncWebServerRequest *request);
+
+    void onWsEvent(AsyncWebSocket *socket, AsyncWebSocketClient *client, AwsEventType type);
+    void pushStatus();
+    static LiveStatus captureLiveStatus();
+    static size_t serializeLiveStatus(const LiveStatus &cur, const LiveStatus *prev, char *out, size_t len);
+
+    void schedule(PendingAction action);
+    void recordLatency(HttpRoute route, uint32_t startUs);
 };
 
 extern WebServerManager webServer;
@@ -0,0 +1,319 @@
+#pragma once
+// Automatisch erzeugt von extra_scripts/build_web_assets.py – nicht bearbeiten!
+#include <Arduino.h>
+
+#define WEB_UI_ETAG "\"9f9c6df2c13a3885\""
+#define WEB_ASSETS_ID "90a86924f879eefb"
+#define WEB_UI_GZ_LEN 4939
+
+static const uint8_t WEB_UI_GZ[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xad, 0x3b, 0xc9, 0x72, 0xdb, 0xc8,
+    0x92, 0x77, 0x7d, 0x45, 0x99, 0xee, 0x6e, 0x82, 0x6d, 0x82, 0xe2, 0x2a, 0x4b, 0xa4, 0x44, 0x3f,
+    0x6d, 0x96, 0xa8, 0x96, 0x64, 0xb5, 0x16, 0xcb, 0x92, 0x43, 0x31, 0x06, 0x81, 0x22, 0x59, 0x22,
+    0xb6, 0x00, 0xc0, 0x4d, 0x6c, 0x46, 0xcc, 0x61, 0xfe, 0x60, 0x3e, 0x60, 0x2e, 0xef, 0x03, 0xe6,
+    0x32, 0xf3, 0x2e, 0x73, 0x6a, 0xff, 0xc9, 0x7c, 0xc9, 0x64, 0x56, 0x15, 0x40, 0x00, 0x24, 0x65,
+    0x69, 0xfa, 0x85, 0xdc, 0x24, 0x50, 0x95, 0x99, 0x95, 0x7b, 0x66, 0x55, 0xb1, 0xb7, 0xdf, 0x1c,
+    0x7c, 0xda, 0xbf, 0xbe, 0xbb, 0x38, 0x24, 0xbd, 0xc0, 0x32, 0x9b, 0x6b, 0xdb, 0xf8, 0x45, 0x4c,
+    0xcd, 0xee, 0xee, 0x64, 0x0c, 0x9a, 0xc1, 0x01, 0xaa, 0x19, 0xf0, 0x65, 0xd1, 0x40, 0x23, 0x7a,
+    0x4f, 0xf3, 0x7c, 0x1a, 0xec, 0x64, 0x6e, 0xae, 0x3f, 0xaa, 0x9b, 0x99, 0x70, 0xd8, 0xd6, 0x2c,
+    0xba, 0x93, 0x19, 0x32, 0x3a, 0x72, 0x1d, 0x2f, 0xc8, 0x10, 0xdd, 0xb1, 0x03, 0x6a, 0x03, 0xd8,
+    0x88, 0x19, 0x41, 0x6f, 0xc7, 0xa0, 0x43, 0xa6, 0x53, 0x95, 0xbf, 0xe4, 0x09, 0xb3, 0x59, 0xc0,
+    0x34, 0x53, 0xf5, 0x75, 0xcd, 0xa4, 0x3b, 0xa5, 0x42, 0x11, 0xc9, 0x04, 0x2c, 0x30, 0x69, 0xf3,
+    0xd3, 0xde, 0xe1, 0xd1, 0xe5, 0xf7, 0x7f, 0x3b, 0xbf, 0xda, 0x3d, 0x50, 0xbf, 0x90, 0xdf, 0x1c,
+    0xbb, 0xc3, 0xba, 0x03, 0x4f, 0x0b, 0x98, 0x63, 0x6f, 0xaf, 0x0b, 0x90, 0xc4, 0x8a, 0x41, 0x8f,
+    0x5a, 0x54, 0xd5, 0x1d, 0xd3, 0xf1, 0x62, 0x8b, 0xbe, 0xdd, 0xd8, 0x78, 0x4f, 0xa9, 0x86, 0x64,
+    0x4d, 0x66, 0xf7, 0x89, 0x47, 0xcd, 0x9d, 0x0c, 0x83, 0xe9, 0x0c, 0xe9, 0x79, 0xb4, 0x03, 0x72,
+    0x69, 0x81, 0x56, 0x67, 0x96, 0xd6, 0xa5, 0xeb, 0xfe, 0xb0, 0xfb, 0x6e, 0x6c, 0x99, 0x8d, 0xb6,
+    0xe6, 0xd3, 0x8d, 0x6a, 0xfe, 0xe2, 0xf8, 0xbc, 0x7c, 0x3f, 0xd9, 0xab, 0xb6, 0x6f, 0xc7, 0x03,
+    0xfd, 0xa9, 0xc8, 0xb4, 0xe3, 0xcb, 0xa2, 0x7e, 0xe0, 0x0c, 0x4f, 0x2b, 0x46, 0xc5, 0x98, 0xd4,
+    0x2a, 0x67, 0x93, 0xda, 0x50, 0xb7, 0xf4, 0xe1, 0xd9, 0xe3, 0xee, 0xe8, 0x6c, 0x7f, 0xeb, 0xc9,
+    0xb0, 0x74, 0xd6, 0x3a, 0xbe, 0x77, 0xef, 0xbf, 0x18, 0xfb, 0xed, 0x4a, 0x77, 0xab, 0xf5, 0xb8,
+    0xdb, 0x3d, 0xdb, 0xdf, 0x2d, 0x9d, 0x5d, 0xb7, 0xba, 0xe7, 0xd7, 0x87, 0x93, 0xd6, 0x63, 0xf5,
+    0xb7, 0xd6, 0xfe, 0xee, 0xe6, 0xfd, 0xd1, 0x67, 0x4b, 0x7f, 0xe2, 0xcf, 0xdd, 0xd6, 0xc1, 0xd8,
+    0xd7, 0x6e, 0x6b, 0xe6, 0xdd, 0x97, 0x93, 0x63, 0xdd, 0xfa, 0xd8, 0xd7, 0x6e, 0x3f, 0x0f, 0x8c,
+    0xfd, 0x3d, 0xf7, 0xfe, 0xa0, 0xc8, 0xee, 0x27, 0xad, 0x2e, 0x3d, 0x38, 0x44, 0x3a, 0x40, 0xb7,
+    0x3b, 0xb9, 0xb8, 0x6a, 0x8d, 0x5b, 0x6c, 0xaf, 0x76, 0x76, 0x5d, 0x64, 0x67, 0xfb, 0x30, 0x77,
+    0xdd, 0x82, 0xb9, 0x43, 0x76, 0xd1, 0x75, 0xba, 0x9c, 0x16, 0xd0, 0xd6, 0x2b, 0x97, 0x43, 0x7d,
+    0x7f, 0x6f, 0x78, 0x6f, 0xdd, 0x3f, 0xdd, 0x7f, 0xf9, 0x1d, 0x71, 0x4d, 0xc0, 0x79, 0x32, 0x8e,
+    0xb6, 0x46, 0xa7, 0xb7, 0xe7, 0xc3, 0xf6, 0xd1, 0x16, 0xd2, 0x79, 0x3c, 0x7f, 0xbc, 0xab, 0xdc,
+    0xdf, 0x7e, 0xee, 0xb5, 0xd8, 0xe6, 0xbb, 0x7d, 0xb6, 0xdb, 0x95, 0xbc, 0x70, 0xb8, 0xd6, 0xd1,
+    0x96, 0x75, 0x6f, 0x9f, 0x9b, 0x06, 0xf0, 0x70, 0x76, 0xbd, 0x3b, 0x3a, 0xb9, 0x6a, 0x75, 0x05,
+    0xdd, 0xd2, 0x63, 0xbb, 0x3c, 0x1e, 0xea, 0x8f, 0x45, 0xd6, 0x7a, 0xd2, 0xcb, 0xe7, 0x47, 0x27,
+    0xbd, 0x33, 0xd6, 0x1a, 0x86, 0xeb, 0x5f, 0xec, 0x6f, 0x2d, 0xca, 0x72, 0x20, 0x64, 0x3e, 0x2d,
+    0x5f, 0x9a, 0xf7, 0xf6, 0x19, 0x5f, 0xeb, 0xe2, 0xf8, 0xc4, 0xbc, 0xab, 0xfc, 0xde, 0x35, 0xca,
+    0x66, 0xdf, 0x38, 0x42, 0x3d, 0xdd, 0x8c, 0x81, 0x4e, 0x57, 0x3b, 0xfa, 0xec, 0xde, 0x97, 0x7b,
+    0x45, 0xe0, 0x0f, 0x75, 0x06, 0x32, 0x9f, 0x54, 0xe1, 0xb9, 0x76, 0x0e, 0x73, 0xf7, 0x96, 0xe9,
+    0xb7, 0x81, 0x1f, 0xe3, 0xcb, 0x89, 0xff, 0xdb, 0xfe, 0xb9, 0xfd, 0xdb, 0x95, 0x5c, 0xf7, 0x60,
+    0x6c, 0xb7, 0x8e, 0xee, 0xdd, 0xf6, 0xd1, 0x68, 0xab, 0x65, 0xd5, 0x86, 0x6d, 0xeb, 0x06, 0xf0,
+    0xce, 0x8b, 0xba, 0xb5, 0xe5, 0xdd, 0x83, 0x9e, 0x5a, 0x65, 0xd0, 0x04, 0xe3, 0xfc, 0x4f, 0xda,
+    0xe5, 0xc0, 0x3c, 0xfd, 0x62, 0xb8, 0xf7, 0xc7, 0x97, 0x0e, 0xd0, 0x9d, 0x7c, 0xda, 0x8f, 0x8d,
+    0xdf, 0x8e, 0xdd, 0xb6, 0xf5, 0xf9, 0xf1, 0xee, 0xcb, 0xee, 0x56, 0xcb, 0x3e, 0x19, 0x1a, 0xb7,
+    0xb5, 0x3e, 0xd7, 0xdb, 0xf1, 0xc9, 0x50, 0x2b, 0xdf, 0x04, 0xed, 0x23, 0x73, 0x70, 0x7f, 0xeb,
+    0x0e, 0xb5, 0xdb, 0xea, 0x7c, 0xfe, 0x31, 0xb2, 0xe1, 0xa3, 0xf6, 0xe5, 0xe4, 0xb1, 0x7d, 0x74,
+    0xd3, 0xbd, 0xe3, 0x76, 0x6f, 0x8d, 0x90, 0xf6, 0x5d, 0xa5, 0x8f, 0xcf, 0x25, 0xe4, 0x1f, 0x75,
+    0x76, 0xfe, 0xf8, 0x3b, 0x3b, 0x9d, 0xdb, 0x7d, 0x74, 0xf7, 0xe5, 0xd2, 0x69, 0x1d, 0x81, 0x8d,
+    0xfa, 0xc5, 0xa7, 0xb3, 0x83, 0xdf, 0xbb, 0xe0, 0x47, 0xd5, 0xd6, 0xe1, 0xe8, 0xe9, 0xfc, 0xb1,
+    0xdb, 0x3d, 0x7b, 0xda, 0x2d, 0xb6, 0x0e, 0x8b, 0xe2, 0x59, 0x8e, 0x73, 0x18, 0x1c, 0x97, 0x36,
+    0x03, 0x7d, 0xdb, 0xa0, 0x83, 0xcd, 0xd3, 0x0a, 0xf8, 0xe9, 0x53, 0x75, 0x27, 0x43, 0x82, 0x89,
+    0x0b, 0x81, 0x90, 0x70, 0x66, 0x74, 0x7c, 0x3f, 0x98, 0x40, 0xb0, 0xfc, 0x3a, 0xb5, 0x34, 0xaf,
+    0xcb, 0xec, 0x7a, 0xb1, 0xe1, 0x6a, 0x86, 0xc1, 0xec, 0x2e, 0x3c, 0xb5, 0x9d, 0xb1, 0xea, 0xb3,
+    0x27, 0x7c, 0x69, 0x3b, 0x9e, 0x41, 0x3d, 0x15, 0x46, 0x66, 0x6d, 0xc7, 0x98, 0x4c, 0x3b, 0x10,
+    0x42, 0x6a, 0x47, 0xb3, 0x98, 0x39, 0xa9, 0xab, 0x9a, 0xeb, 0x9a, 0x54, 0xf5, 0x27, 0x7e, 0x40,
+    0xad, 0xfc, 0x1e, 0x46, 0xd2, 0x99, 0xa6, 0x5f, 0xf1, 0xd7, 0x8f, 0x00, 0x97, 0xcf, 0x5e, 0xd1,
+    0xae, 0x43, 0xc9, 0x4d, 0x2b, 0x9b, 0xbf, 0x74, 0xda, 0x4e, 0xe0, 0xe4, 0x7d, 0xcd, 0xf6, 0x55,
+    0x9f, 0x7a, 0xac, 0x03, 0xf1, 0xa4, 0xf7, 0xbb, 0x9e, 0x33, 0xb0, 0x8d, 0x3a, 0x60, 0x52, 0xcd,
+    0x53, 0xbb, 0x9e, 0x66, 0x30, 0x88, 0x4f, 0xa5, 0x54, 0xa9, 0x19, 0xb4, 0x9b, 0x97, 0x51, 0x4a,
+    0x8a, 0x3f, 0xe7, 0xdf, 0xbe, 0xdf, 0xa8, 0xb6, 0xb5, 0x32, 0x29, 0x15, 0x8b, 0x3f, 0xe7, 0x1a,
+    0x16, 0xb3, 0xd5, 0x1e, 0x65, 0xdd, 0x5e, 0x50, 0x87, 0x81, 0x61, 0xaf, 0x61, 0x30, 0xdf, 0x35,
+    0xb5, 0x49, 0xbd, 0x63, 0xd2, 0x71, 0xe3, 0x71, 0xe0, 0x07, 0xac, 0x33, 0x51, 0x65, 0xb4, 0xd7,
+    0x75, 0xf8, 0xa0, 0x5e, 0x43, 0x33, 0x59, 0xd7, 0x56, 0x19, 0xf0, 0xe6, 0x87, 0x43, 0xa1, 0xc4,
+    0xe5, 0xa2, 0x3b, 0x9e, 0x15, 0x10, 0x5e, 0x03, 0x4e, 0xbc, 0x69, 0x8c, 0xb5, 0x51, 0x0f, 0x30,
+    0x1a, 0x52, 0x0b, 0xc8, 0xdf, 0xc0, 0xe7, 0xe0, 0x42, 0x47, 0x3d, 0xcd, 0x70, 0x46, 0xf5, 0x22,
+    0xc1, 0x11, 0xb2, 0x81, 0x1f, 0x5e, 0xb7, 0xad, 0x29, 0xc5, 0x3c, 0xff, 0x2b, 0x54, 0x80, 0x55,
+    0x6d, 0x2c, 0xb2, 0x5a, 0xbd, 0x56, 0x44, 0x34, 0xf1, 0x8c, 0x62, 0x44, 0xab, 0x57, 0x71, 0xf5,
+    0x5e, 0x69, 0xca, 0x93, 0x54, 0xfd, 0x6d, 0xa5, 0x52, 0x69, 0x08, 0x9b, 0x80, 0xd6, 0x83, 0xc0,
+    0xb1, 0x00, 0x1a, 0x10, 0xb9, 0xe2, 0xc1, 0x28, 0xb4, 0x5e, 0xde, 0x44, 0x6e, 0xfd, 0x41, 0x9b,
+    0xa7, 0xbb, 0x10, 0x6d, 0x63, 0x63, 0x23, 0x85, 0x56, 0x49, 0xa2, 0x95, 0xaa, 0x88, 0xc6, 0xec,
+    0x8e, 0x03, 0x8a, 0x66, 0xc6, 0x34, 0xd4, 0x19, 0xbe, 0x34, 0xf0, 0x43, 0x05, 0xd5, 0xc0, 0x48,
+    0xc0, 0xd3, 0xe5, 0xc0, 0xb2, 0xfd, 0x7a, 0xa9, 0xe3, 0x11, 0xf8, 0xaf, 0xd1, 0xd5, 0xdc, 0x7a,
+    0xa9, 0x06, 0xd4, 0x92, 0x0b, 0x94, 0x6b, 0x11, 0x45, 0x5d, 0xf3, 0x8c, 0xb8, 0xda, 0xde, 0x76,
+    0x8a, 0x9d, 0x6a, 0xa7, 0x13, 0x2a, 0xce, 0xa4, 0x9d, 0xa0, 0x0e, 0xeb, 0x13, 0xdf, 0x31, 0x99,
+    0x41, 0xa4, 0x61, 0x23, 0x0d, 0x70, 0xda, 0x49, 0x1d, 0x6f, 0x26, 0x48, 0x13, 0x3f, 0xf0, 0x1c,
+    0xbb, 0x3b, 0x97, 0x95, 0xa3, 0x87, 0x12, 0xb4, 0x4d, 0x47, 0xef, 0xa7, 0x78, 0xab, 0x25, 0x65,
+    0x2f, 0xa7, 0xc8, 0xb9, 0x9a, 0x1d, 0xd7, 0x77, 0x0c, 0x72, 0x23, 0x44, 0x1c, 0x09, 0x07, 0xdb,
+    0x28, 0x16, 0x67, 0x05, 0xd7, 0xa3, 0x58, 0xba, 0xa6, 0x2f, 0xf1, 0xb3, 0x65, 0x3a, 0x92, 0xf8,
+    0x44, 0xd7, 0xec, 0xa1, 0xe6, 0x27, 0x14, 0x55, 0x2a, 0x95, 0x16, 0x45, 0x6f, 0xf0, 0x68, 0x55,
+    0x3d, 0x6a, 0xc3, 0x38, 0x6a, 0xc8, 0x65, 0x63, 0x8a, 0xa6, 0x31, 0x66, 0x85, 0x1e, 0xf3, 0x03,
+    0xc7, 0x9b, 0xc8, 0xb8, 0x55, 0x03, 0xc7, 0x95, 0x8b, 0xc8, 0x09, 0xce, 0x8f, 0xe7, 0x98, 0xfe,
+    0xab, 0x2d, 0x5c, 0x5c, 0xb0, 0x70, 0xa9, 0x18, 0x23, 0x1c, 0x72, 0x1f, 0x73, 0xe1, 0x84, 0xc5,
+    0xdf, 0xc3, 0x5f, 0x7b, 0x99, 0x19, 0x43, 0xc6, 0x4c, 0xda, 0x05, 0x81, 0xa6, 0x01, 0x1d, 0x07,
+    0x2a, 0x8f, 0xc6, 0x50, 0x65, 0x31, 0xf5, 0x57, 0x80, 0x87, 0x45, 0x8f, 0x46, 0x21, 0xb9, 0x8c,
+    0x26, 0x1b, 0x52, 0x95, 0xd9, 0x06, 0xd3, 0x35, 0x20, 0x19, 0x49, 0xc8, 0x6c, 0x4c, 0x21, 0xaa,
+    0x70, 0x04, 0xc1, 0x1f, 0x6a, 0x51, 0xe6, 0x08, 0x7c, 0x8c, 0x73, 0x5a, 0xde, 0xd4, 0xde, 0x57,
+    0x6b, 0x29, 0x4e, 0x6b, 0x20, 0x8e, 0x5c, 0xcd, 0xe3, 0x58, 0xe8, 0x41, 0x9a, 0x0d, 0x86, 0xc0,
+    0xde, 0xa2, 0xee, 0x0e, 0x4c, 0x9f, 0x92, 0xb2, 0x0f, 0xbd, 0x49, 0x07, 0xdb, 0x13, 0x3a, 0xfb,
+    0x5b, 0x9f, 0x4e, 0x3a, 0x1e, 0x34, 0x19, 0x3e, 0xe1, 0x93, 0x53, 0x48, 0x53, 0xa8, 0x94, 0xa9,
+    0xe3, 0x6a, 0x3a, 0x0b, 0x26, 0xf5, 0xd2, 0xac, 0x16, 0x7b, 0x2b, 0x16, 0x6a, 0xb3, 0x59, 0xa1,
+    0xe3, 0x78, 0x96, 0x8a, 0x7c, 0xb8, 0xd3, 0x25, 0x7e, 0x62, 0x6a, 0x6d, 0x6a, 0x4e, 0x9f, 0x73,
+    0xeb, 0xcd, 0xb9, 0x7a, 0x22, 0xbf, 0x9d, 0x3b, 0x6a, 0x3a, 0xda, 0x99, 0xed, 0x0e, 0x82, 0xaf,
+    0x22, 0xff, 0x7b, 0xd0, 0xaf, 0xd1, 0xcc, 0x43, 0xdc, 0x7a, 0x71, 0xf5, 0x24, 0x75, 0x91, 0x52,
+    0x98, 0x61, 0x18, 0x0d, 0x67, 0x10, 0xa0, 0x8e, 0xeb, 0xb6, 0x63, 0xd3, 0x06, 0xac, 0xd9, 0xee,
+    0xb3, 0x00, 0x0b, 0x00, 0x24, 0x6e, 0xcd, 0xd6, 0xc5, 0xf8, 0xb2, 0x05, 0xeb, 0xf5, 0x10, 0xd8,
+    0x87, 0xd0, 0x87, 0x35, 0x82, 0xde, 0xc0, 0x6a, 0x4f, 0x57, 0x50, 0x90, 0xc6, 0xe3, 0x19, 0x56,
+    0xb2, 0x27, 0xb3, 0x6d, 0xda, 0x56, 0x71, 0xfe, 0x64, 0x3e, 0xd0, 0x07, 0x9e, 0x0f, 0x9a, 0x71,
+    0x1d, 0x86, 0x5e, 0xb5, 0x82, 0x19, 0xcb, 0x79, 0x52, 0xf9, 0x9b, 0x64, 0xe4, 0x9f, 0xb7, 0xa0,
+    0xc4, 0x11, 0x9a, 0x28, 0x0c, 0x35, 0x73, 0x40, 0x55, 0x69, 0xcb, 0x67, 0x7d, 0xbe, 0x5c, 0x4d,
+    0xa5, 0x9c, 0xb6, 0x63, 0x1a, 0x8d, 0x64, 0xaa, 0x8b, 0xc5, 0x01, 0x8f, 0x49, 0x9f, 0x9a, 0x54,
+    0x0f, 0xf2, 0x71, 0x11, 0x71, 0x89, 0xa4, 0x7d, 0xa3, 0xf4, 0x5a, 0x8e, 0x04, 0xaa, 0x97, 0xe7,
+    0x49, 0x18, 0xad, 0xba, 0x98, 0x79, 0x52, 0xa9, 0x70, 0xa1, 0x14, 0xa6, 0x94, 0x2c, 0x18, 0xa9,
+    0x77, 0x1c, 0x7d, 0xe0, 0x2f, 0x61, 0x47, 0x4c, 0x4c, 0x13, 0xce, 0x23, 0xd7, 0x4c, 0x08, 0x38,
+    0x2b, 0xb4, 0x07, 0xe0, 0xe0, 0xb6, 0x8c, 0x8d, 0xbf, 0x90, 0xb9, 0x50, 0x45, 0x58, 0xf9, 0x66,
+    0x82, 0xe0, 0x74, 0x49, 0x8d, 0x49, 0xb0, 0xb1, 0x5c, 0xf4, 0xea, 0x62, 0x15, 0x48, 0x5b, 0x3b,
+    0x00, 0x2f, 0xf2, 0x19, 0x4f, 0x0e, 0x9a, 0x69, 0x12, 0xa8, 0xf6, 0x3e, 0x48, 0x11, 0xd8, 0xaa,
+    0xeb, 0x41, 0xd2, 0x80, 0x04, 0xbd, 0xcc, 0x61, 0xb8, 0xcc, 0x5c, 0x91, 0x09, 0xd8, 0x7a, 0xcf,
+    0x19, 0x26, 0xfb, 0x8e, 0xb7, 0xb5, 0xda, 0xc6, 0xa6, 0x51, 0x11, 0xab, 0x60, 0xd6, 0xa8, 0xf3,
+    0x27, 0x54, 0xc1, 0x9d, 0xa2, 0x82, 0x15, 0x73, 0x82, 0x80, 0x4f, 0x21, 0xdd, 0x1b, 0xe9, 0xe5,
+    0x68, 0x11, 0xff, 0x62, 0x99, 0x22, 0x05, 0xbc, 0x64, 0x3d, 0xa3, 0x88, 0x7f, 0x02, 0xce, 0xc0,
+    0xf8, 0x48, 0x4d, 0xeb, 0x95, 0x1a, 0xe4, 0xcc, 0x05, 0x01, 0x04, 0xe8, 0x12, 0x7a, 0xfa, 0x66,
+    0x99, 0xaf, 0xeb, 0x07, 0x5a, 0x00, 0x1e, 0x10, 0xaf, 0x56, 0x68, 0xad, 0xe7, 0x4b, 0x7f, 0x63,
+    0x45, 0xbc, 0xc4, 0xac, 0x11, 0xba, 0x88, 0x88, 0x36, 0xb1, 0x0a, 0x34, 0x45, 0xba, 0x4e, 0xfd,
+    0x64, 0x81, 0x35, 0xaa, 0xd4, 0x30, 0x42, 0xd5, 0xbf, 0x2d, 0xd5, 0x6a, 0xef, 0xcb, 0xd5, 0x64,
+    0xeb, 0x10, 0xa1, 0x53, 0xcf, 0x73, 0x92, 0x52, 0x74, 0x36, 0x8d, 0xf7, 0x73, 0xe4, 0xf7, 0xe5,
+    0x92, 0xbe, 0x80, 0xbc, 0xbd, 0x2e, 0x3a, 0xe9, 0xb5, 0xed, 0x75, 0xb9, 0x0f, 0xc6, 0x46, 0x19,
+    0xbe, 0x0c, 0x36, 0x24, 0xba, 0xa9, 0xf9, 0xfe, 0x4e, 0x26, 0x6a, 0x2d, 0xf9, 0x6e, 0xb9, 0x94,
+    0xdc, 0xc5, 0x02, 0x5e, 0x09, 0x86, 0xdd, 0x10, 0x38, 0xec, 0xec, 0x32, 0xcd, 0xd4, 0xf6, 0xd6,
+    0x4d, 0x12, 0x8d, 0x5a, 0xb9, 0xcc, 0x92, 0x71, 0x6c, 0x73, 0x44, 0x97, 0x8f, 0x8d, 0x53, 0xf3,
+    0xf6, 0x74, 0xf7, 0x1c, 0x19, 0xe5, 0x2f, 0x30, 0x0a, 0xfd, 0x0f, 0x61, 0x06, 0xac, 0xe5, 0x23,
+    0xfa, 0xff, 0xfe, 0xeb, 0xbf, 0xc3, 0x24, 0x8c, 0xa1, 0x10, 0x40, 0xe9, 0xc7, 0xf4, 0x5a, 0x17,
+    0xea, 0xae, 0xe1, 0x81, 0xaa, 0xe9, 0x32, 0xaa, 0xcc, 0xfd, 0xff, 0xd0, 0xbc, 0x02, 0x6b, 0x6b,
+    0xe6, 0x32, 0x7a, 0x1e, 0xb0, 0xc9, 0x29, 0x12, 0x63, 0xcf, 0x7a, 0x25, 0x55, 0x41, 0x45, 0x02,
+    0x24, 0xdb, 0x87, 0x4c, 0x53, 0xd2, 0xba, 0xa7, 0x2c, 0x58, 0xb6, 0x6e, 0xc0, 0x2c, 0xb0, 0x82,
+    0xaa, 0xd6, 0xf9, 0xbf, 0x57, 0x2e, 0x7c, 0x4b, 0x03, 0xf0, 0xdb, 0x65, 0x64, 0x47, 0x54, 0x0b,
+    0x7a, 0xe8, 0x0b, 0x4b, 0x74, 0xb4, 0x48, 0x5b, 0xf6, 0x8e, 0x48, 0x59, 0x34, 0x60, 0x9c, 0x46,
+    0x38, 0x4a, 0xc4, 0xf9, 0x49, 0xa6, 0xb4, 0x51, 0xcc, 0x10, 0x51, 0xc0, 0xc4, 0x0b, 0xc8, 0x26,
+    0xc0, 0xe7, 0x44, 0x31, 0x8d, 0x08, 0xab, 0x03, 0x6b, 0x10, 0x7c, 0xfe, 0x47, 0x18, 0x48, 0x39,
+    0xcf, 0xbc, 0x41, 0xe1, 0x87, 0x23, 0xd8, 0x90, 0x10, 0x18, 0xdb, 0xc9, 0xb4, 0x79, 0x57, 0x64,
+    0x83, 0xc9, 0x33, 0xcd, 0x63, 0x6a, 0x42, 0x68, 0xf6, 0xb9, 0xd6, 0x38, 0x08, 0x80, 0xf2, 0xdc,
+    0x4f, 0xe2, 0xd5, 0x96, 0x2f, 0x15, 0x43, 0x93, 0x27, 0x32, 0xf1, 0x11, 0xd8, 0xc8, 0x01, 0xb7,
+    0xc0, 0x39, 0x6c, 0x93, 0x76, 0x32, 0xe5, 0x5a, 0x2d, 0x43, 0x78, 0xdd, 0xc4, 0x41, 0x18, 0x75,
+    0x6c, 0x4e, 0x75, 0x27, 0x33, 0x70, 0x0d, 0x48, 0x7c, 0x9f, 0x71, 0x4a, 0x09, 0xa0, 0x9d, 0x14,
+    0xd5, 0x35, 0x97, 0xe2, 0x3d, 0x51, 0x72, 0xd3, 0xcb, 0x73, 0xe4, 0x4c, 0x13, 0xe8, 0xae, 0x56,
+    0xf5, 0x4a, 0xe1, 0x2d, 0x07, 0x0f, 0xba, 0x76, 0xed, 0x27, 0x50, 0x30, 0x85, 0x97, 0x81, 0x3f,
+    0x17, 0x5c, 0x54, 0x40, 0xbe, 0x1a, 0x07, 0x93, 0x62, 0x0a, 0x94, 0xb5, 0x6d, 0xc7, 0xc5, 0xe0,
+    0x0d, 0xc5, 0x02, 0xbb, 0xdc, 0xf4, 0x3c, 0x20, 0x13, 0x10, 0xe5, 0xf8, 0xb8, 0x7e, 0x76, 0x96,
+    0xdb, 0x5e, 0x17, 0x10, 0x0b, 0xa0, 0xa5, 0x4c, 0xf3, 0x8a, 0xf6, 0x21, 0x0b, 0x51, 0x7b, 0x25,
+    0x4c, 0x39, 0xd3, 0x3c, 0x80, 0xcc, 0x65, 0x11, 0xe5, 0xfa, 0xba, 0xf0, 0x1c, 0xb1, 0x4a, 0x26,
+    0xf2, 0xc7, 0x15, 0x10, 0x55, 0x90, 0x6f, 0x00, 0x2d, 0x26, 0xe4, 0x9a, 0x3e, 0x97, 0x90, 0x48,
+    0x46, 0xd7, 0x7f, 0xc8, 0x45, 0x2d, 0xd3, 0x3c, 0x02, 0x99, 0x89, 0xd3, 0x21, 0xa7, 0xac, 0x43,
+    0x57, 0xc2, 0x6d, 0x64, 0x9a, 0x17, 0x10, 0x0a, 0x2b, 0xe7, 0xdf, 0x03, 0x93, 0xec, 0x23, 0x23,
+    0x22, 0x11, 0x10, 0xe5, 0xb6, 0x75, 0xb1, 0x5a, 0xa2, 0xcd, 0x4c, 0xf3, 0x4c, 0x0b, 0x3c, 0x36,
+    0x26, 0x97, 0x90, 0x59, 0x7f, 0x00, 0xbc, 0x95, 0x69, 0x7e, 0x76, 0x3c, 0x88, 0x39, 0x1f, 0xb6,
+    0x55, 0xa0, 0x2c, 0x68, 0x26, 0x28, 0x64, 0xd5, 0x81, 0xb7, 0x7e, 0x89, 0x7b, 0x92, 0x67, 0x8c,
+    0x00, 0x06, 0x3b, 0x10, 0x0e, 0x45, 0x34, 0xb4, 0x7a, 0x04, 0xb7, 0x2e, 0xec, 0xfe, 0x3a, 0x3f,
+    0xc2, 0x9d, 0x40, 0x68, 0x09, 0xf2, 0xe7, 0x3f, 0xc8, 0x55, 0xa0, 0x19, 0x2b, 0x62, 0x88, 0xf7,
+    0x4f, 0xdc, 0xab, 0x38, 0x92, 0xf4, 0x2a, 0xf1, 0x0c, 0xec, 0xe8, 0xb4, 0x07, 0x5d, 0x22, 0x05,
+    0x9a, 0x4f, 0x05, 0xb2, 0x07, 0xff, 0xa8, 0x07, 0x1d, 0x56, 0x14, 0x3e, 0x19, 0xb2, 0xbe, 0x94,
+    0xb3, 0x78, 0x97, 0x85, 0xbc, 0x89, 0x77, 0xb9, 0x24, 0x14, 0x1e, 0x8b, 0xe1, 0xd9, 0xac, 0x84,
+    0x9d, 0xf7, 0x27, 0xe0, 0x8a, 0x2e, 0x65, 0x3a, 0x28, 0x10, 0xbc, 0x40, 0xe0, 0xa4, 0x91, 0xc5,
+    0x4b, 0x02, 0x39, 0x6a, 0x37, 0x30, 0x92, 0x75, 0x93, 0xe9, 0x7d, 0x48, 0x0d, 0x14, 0x6a, 0xad,
+    0x17, 0x28, 0x10, 0xbb, 0xe7, 0x74, 0xc0, 0x9f, 0xff, 0x22, 0xc5, 0x0e, 0xf3, 0xac, 0x91, 0xe6,
+    0xd1, 0x1b, 0x9e, 0x23, 0x90, 0xf0, 0x47, 0x39, 0xa2, 0x8a, 0xa1, 0x57, 0xd0, 0x17, 0xdd, 0x4c,
+    0x92, 0x5d, 0x1a, 0xa0, 0x53, 0x22, 0x5d, 0xee, 0x9c, 0x97, 0x38, 0x12, 0x23, 0x19, 0x26, 0x13,
+    0xb4, 0x79, 0x52, 0xd7, 0x72, 0xdb, 0x9b, 0x59, 0x3a, 0x1a, 0xed, 0xd2, 0x33, 0xc9, 0x14, 0x22,
+    0xa7, 0xaf, 0x60, 0xdb, 0x4f, 0x7d, 0xce, 0x48, 0x0f, 0x79, 0xda, 0xc9, 0x18, 0x9e, 0x36, 0x3a,
+    0x16, 0x93, 0x4a, 0x6e, 0x31, 0xb1, 0x40, 0xeb, 0x01, 0x06, 0xfd, 0xe8, 0x51, 0x06, 0x9e, 0x75,
+    0x0c, 0x2f, 0x2b, 0x5d, 0xda, 0x84, 0x4e, 0x0c, 0x8c, 0x00, 0x31, 0xeb, 0x7d, 0xff, 0xef, 0xef,
+    0xff, 0x11, 0x48, 0x78, 0x75, 0x0f, 0xbb, 0x99, 0xd5, 0x58, 0x8e, 0x03, 0xf4, 0x4f, 0xe1, 0x53,
+    0x3d, 0xd0, 0x06, 0xcf, 0xe4, 0x11, 0x51, 0xab, 0xb1, 0xdf, 0x50, 0xc3, 0x82, 0xbe, 0x02, 0x92,
+    0x6f, 0x9e, 0xa3, 0xf0, 0x52, 0x2f, 0x06, 0x7e, 0x6f, 0x69, 0x7c, 0x2d, 0x6a, 0xe7, 0x9a, 0x49,
+    0x23, 0x49, 0xdd, 0x98, 0x8e, 0x66, 0x3c, 0xa3, 0x1b, 0xa8, 0x32, 0x83, 0x00, 0x73, 0x3f, 0xc4,
+    0x1b, 0x66, 0xb2, 0x95, 0x1c, 0xf5, 0x9c, 0x01, 0x54, 0xe5, 0x32, 0xb9, 0x86, 0x2c, 0xb1, 0x12,
+    0xc8, 0x80, 0xda, 0xd2, 0xac, 0x14, 0xd3, 0x40, 0x0b, 0xf9, 0x20, 0x56, 0xac, 0x25, 0xdb, 0xfb,
+    0x3d, 0x0d, 0xaf, 0x3e, 0x64, 0xc5, 0xae, 0x16, 0xe3, 0x15, 0xbb, 0x9a, 0xac, 0xd8, 0x4b, 0x1c,
+    0x46, 0x9c, 0x9e, 0x64, 0xe2, 0x04, 0x4f, 0xc5, 0x90, 0xe8, 0x23, 0x16, 0x8a, 0x1a, 0xaf, 0xf4,
+    0xbc, 0xb1, 0x8d, 0x7c, 0x5c, 0xbe, 0x36, 0x53, 0xd0, 0xbe, 0xee, 0x31, 0x37, 0x68, 0x6a, 0xfe,
+    0xc4, 0xd6, 0x49, 0x67, 0x60, 0xeb, 0x5c, 0x5e, 0xd4, 0xea, 0x95, 0xec, 0x14, 0x94, 0x1c, 0x99,
+    0xae, 0x05, 0xde, 0x04, 0x3e, 0xc1, 0x71, 0xfd, 0x80, 0x40, 0x60, 0xb8, 0xf0, 0x40, 0xc9, 0x0e,
+    0xd1, 0x46, 0x1a, 0x94, 0xb3, 0x0e, 0x0d, 0xf4, 0x9e, 0x92, 0x5d, 0xd7, 0x5c, 0xb6, 0x1e, 0xf6,
+    0x17, 0xd9, 0x5c, 0x43, 0x82, 0xe3, 0x7d, 0x4a, 0x04, 0x1a, 0xe2, 0x16, 0x1e, 0x7d, 0xc7, 0x56,
+    0x00, 0xc6, 0x80, 0x4d, 0xa2, 0x05, 0x6d, 0x7e, 0xa1, 0x4b, 0x83, 0x43, 0x93, 0xe2, 0xe3, 0xde,
+    0xa4, 0x65, 0x28, 0xd9, 0x79, 0xf9, 0xce, 0xe6, 0x44, 0xcd, 0x07, 0x22, 0x48, 0xab, 0x30, 0x9f,
+    0x69, 0xac, 0xc5, 0xbb, 0x83, 0xd4, 0xe4, 0x73, 0xc4, 0xb1, 0x42, 0xc7, 0xc8, 0x5e, 0x05, 0x78,
+    0xd2, 0x26, 0x08, 0xe0, 0xd4, 0x73, 0xa8, 0x98, 0x86, 0xd3, 0x1c, 0xe1, 0x58, 0x63, 0x6d, 0x46,
+    0xa0, 0xb5, 0xd4, 0x7b, 0x44, 0xe1, 0x7b, 0x89, 0x9c, 0xd4, 0x97, 0x63, 0x52, 0xb1, 0xb9, 0x50,
+    0xb2, 0xa1, 0x46, 0xb9, 0x7a, 0x49, 0x47, 0x63, 0x26, 0x35, 0xea, 0xd9, 0x3c, 0x11, 0xf0, 0x40,
+    0x00, 0xfe, 0x96, 0x19, 0x82, 0x5b, 0xee, 0x95, 0x66, 0xe0, 0x38, 0x7f, 0xd9, 0x08, 0xb8, 0x47,
+    0x00, 0x61, 0xb1, 0x20, 0xed, 0x8b, 0xa3, 0xce, 0x50, 0x64, 0x9c, 0x79, 0x06, 0x91, 0xb9, 0xcb,
+    0xd1, 0x98, 0xdb, 0x58, 0xc3, 0xab, 0x83, 0xc9, 0x29, 0xb4, 0xe3, 0x5c, 0xe1, 0xb9, 0x97, 0x28,
+    0x8e, 0x4b, 0x43, 0x84, 0xb1, 0x57, 0x28, 0x4e, 0xc8, 0x89, 0x5d, 0x3e, 0xac, 0x35, 0x9d, 0x35,
+    0xd6, 0x22, 0x1d, 0xc6, 0xd6, 0xa3, 0x26, 0x2c, 0x08, 0xf4, 0x3f, 0xb5, 0x1f, 0x21, 0x60, 0x0b,
+    0x10, 0x18, 0x90, 0xa7, 0x14, 0x44, 0xca, 0x13, 0x31, 0xd9, 0x58, 0x63, 0x1d, 0x22, 0x00, 0x0b,
+    0xb8, 0x07, 0x20, 0x6f, 0x76, 0x76, 0x08, 0x66, 0x8e, 0x0e, 0xec, 0xe1, 0x8c, 0x1c, 0x59, 0x29,
+    0x31, 0x02, 0x2f, 0xc8, 0x8c, 0x94, 0x39, 0x99, 0x38, 0x59, 0x4c, 0x93, 0x2f, 0x26, 0x8b, 0xc0,
+    0xcb, 0xc9, 0x72, 0x32, 0xef, 0x48, 0x16, 0x37, 0x46, 0xd9, 0x04, 0xdb, 0xd0, 0xe2, 0x24, 0xe9,
+    0x93, 0x3f, 0xfe, 0x10, 0xe2, 0x15, 0xe4, 0xfe, 0x23, 0xbd, 0xfc, 0x74, 0xb5, 0x25, 0x25, 0x46,
+    0x9a, 0x87, 0x35, 0x45, 0xc8, 0xb6, 0xb8, 0xd6, 0x07, 0x12, 0xcd, 0x14, 0x02, 0xe7, 0x23, 0x1b,
+    0x53, 0x43, 0x29, 0xe5, 0x38, 0xa7, 0x7f, 0xfe, 0xe7, 0x7e, 0x96, 0xd4, 0x49, 0x16, 0x92, 0x56,
+    0x16, 0x46, 0x24, 0x8d, 0x90, 0xa7, 0x0f, 0x08, 0xf1, 0x0f, 0xf8, 0x78, 0x47, 0x12, 0xe3, 0x80,
+    0x90, 0xe5, 0x46, 0x16, 0x26, 0x9e, 0x47, 0x38, 0x3a, 0xd5, 0x4b, 0xd2, 0x47, 0x5c, 0x39, 0x31,
+    0xec, 0x24, 0xdb, 0xbf, 0xfc, 0x32, 0x27, 0xa6, 0x81, 0xe3, 0x0c, 0xa9, 0xa4, 0xc7, 0xe1, 0x62,
+    0x69, 0x05, 0x94, 0x35, 0x7f, 0x8b, 0xf2, 0x00, 0xe7, 0x78, 0x55, 0x66, 0x4a, 0x4d, 0xc6, 0x84,
+    0xc1, 0x6c, 0xf3, 0x9c, 0x18, 0x22, 0x51, 0xc5, 0x05, 0xe0, 0x18, 0xaf, 0x61, 0x9d, 0x27, 0x34,
+    0x60, 0x1a, 0xbf, 0xd3, 0x19, 0x8f, 0x33, 0x26, 0x33, 0x1e, 0x06, 0x91, 0x49, 0x03, 0xe2, 0x3a,
+    0xa6, 0x79, 0x0d, 0x2e, 0xeb, 0x01, 0x98, 0x3d, 0x30, 0xcd, 0x58, 0x24, 0x01, 0xcf, 0x36, 0xc4,
+    0x0d, 0x8f, 0xa5, 0x5c, 0x94, 0x88, 0x7c, 0x68, 0x1e, 0x28, 0xba, 0xa5, 0x4d, 0x47, 0xe4, 0x96,
+    0xb6, 0xaf, 0xf8, 0xbb, 0xf2, 0x6d, 0xe4, 0xd7, 0xd7, 0xd7, 0x7f, 0x9a, 0x42, 0x6f, 0xc1, 0x0f,
+    0x31, 0x0a, 0x3d, 0xc7, 0x0f, 0x66, 0xeb, 0x23, 0xff, 0x1b, 0x2c, 0x26, 0x70, 0x0a, 0x8e, 0xed,
+    0xb8, 0xd4, 0x06, 0x54, 0x20, 0xb7, 0xd3, 0x44, 0x8a, 0x26, 0xd5, 0xbc, 0x16, 0x9e, 0xfa, 0x00,
+    0xa7, 0x4a, 0xc4, 0x0a, 0x60, 0x2c, 0xb2, 0x35, 0x8b, 0x91, 0xb1, 0x40, 0xad, 0xd8, 0xdf, 0x03,
+    0x25, 0x3a, 0x04, 0xc9, 0x39, 0xb9, 0x79, 0xe0, 0x9f, 0x5c, 0x7d, 0x3a, 0x2f, 0xb8, 0xf8, 0xeb,
+    0x04, 0x31, 0x5d, 0xe0, 0x99, 0x27, 0xce, 0x87, 0x6e, 0x3a, 0x3c, 0x95, 0x86, 0x8c, 0xa0, 0xc2,
+    0xdf, 0xcc, 0xd7, 0x4f, 0x68, 0x05, 0x6a, 0x5c, 0xc4, 0xe2, 0x3c, 0x41, 0xe7, 0xf1, 0x86, 0xb2,
+    0x88, 0x34, 0x69, 0x80, 0x90, 0xce, 0x20, 0x50, 0x62, 0x0a, 0xcb, 0x93, 0x8a, 0x98, 0x9e, 0xcd,
+    0xad, 0xcf, 0xdb, 0x20, 0xa9, 0xb8, 0x1b, 0x66, 0x07, 0x9b, 0xbb, 0x9e, 0xa7, 0x4d, 0x94, 0x4a,
+    0x39, 0x17, 0x53, 0x3a, 0x76, 0x7f, 0x17, 0x62, 0xcb, 0x1f, 0x53, 0xba, 0x1e, 0x8c, 0x9f, 0xf3,
+    0x1b, 0x79, 0x46, 0x00, 0x51, 0x0b, 0x33, 0x3c, 0x68, 0xc7, 0x81, 0x92, 0x2d, 0x1b, 0xbc, 0x22,
+    0x04, 0xe3, 0x42, 0x87, 0x99, 0xe6, 0x15, 0x9e, 0x5d, 0x01, 0x91, 0x2c, 0x5e, 0x44, 0x65, 0xe7,
+    0xe3, 0x97, 0xc0, 0xb1, 0x52, 0xcc, 0x13, 0xf8, 0x57, 0xda, 0x10, 0x1f, 0x4b, 0xb1, 0x3a, 0x1d,
+    0xba, 0xd5, 0x2e, 0x02, 0x22, 0xf4, 0xbf, 0x44, 0x41, 0xd7, 0x99, 0xc0, 0x78, 0xb1, 0x01, 0x5f,
+    0xdb, 0x80, 0x04, 0xdf, 0xef, 0xde, 0xcd, 0x19, 0xf6, 0x9c, 0x11, 0xaa, 0x97, 0x8b, 0xfc, 0x75,
+    0x42, 0x7e, 0x25, 0xe5, 0x07, 0xb2, 0xbd, 0x4d, 0x36, 0x73, 0xe4, 0x0f, 0x12, 0x1b, 0x84, 0xe0,
+    0x2f, 0x3d, 0xc4, 0x48, 0x8e, 0x05, 0xc9, 0xb1, 0x24, 0x39, 0x16, 0x24, 0xd1, 0x3a, 0x48, 0xf0,
+    0x17, 0xa2, 0x14, 0xc7, 0x9b, 0xa0, 0x57, 0xd2, 0x6c, 0x92, 0x71, 0x2e, 0x47, 0x12, 0x32, 0x8c,
+    0x81, 0x60, 0xa9, 0x88, 0x14, 0xf3, 0x64, 0x12, 0x7b, 0xde, 0x84, 0x7f, 0xd2, 0xe1, 0x67, 0x0b,
+    0xce, 0xbd, 0xa8, 0xea, 0xd7, 0xfa, 0xf7, 0xba, 0x3c, 0x86, 0x88, 0xf9, 0x79, 0x9b, 0xd9, 0xb0,
+    0x73, 0xb9, 0x86, 0xbd, 0x07, 0x6a, 0x4e, 0x43, 0x2b, 0xb7, 0x07, 0xa0, 0x3f, 0x2f, 0xfb, 0x23,
+    0x1f, 0x0e, 0x99, 0xb0, 0xfc, 0xee, 0xa2, 0xa3, 0xc4, 0x7c, 0x59, 0xa4, 0x08, 0x80, 0xfa, 0x5a,
+    0x7c, 0x20, 0x3b, 0x10, 0xf6, 0xc5, 0x71, 0x75, 0x0f, 0x65, 0xe0, 0xba, 0x2d, 0x80, 0x4f, 0xe2,
+    0x24, 0x5e, 0x1d, 0xf3, 0xd5, 0x15, 0x50, 0x43, 0xa5, 0x92, 0xe3, 0xc5, 0x97, 0xe2, 0xf5, 0xd6,
+    0x22, 0x76, 0x75, 0xae, 0x01, 0x4b, 0xf3, 0xfb, 0xc8, 0x16, 0x87, 0x28, 0x71, 0xbb, 0x95, 0xab,
+    0x68, 0x38, 0x3e, 0x20, 0x0c, 0x59, 0xda, 0x88, 0x06, 0x2a, 0x73, 0xcb, 0xe2, 0x6b, 0xf5, 0x21,
+    0x07, 0xe6, 0x69, 0x82, 0x19, 0x45, 0x7e, 0x01, 0x4a, 0xb5, 0x98, 0x85, 0x99, 0xb0, 0x30, 0x03,
+    0x0b, 0x57, 0xca, 0xf0, 0x3d, 0xb7, 0x30, 0x5f, 0x16, 0x4c, 0x5c, 0x42, 0x72, 0x0c, 0xac, 0x2b,
+    0xfc, 0x84, 0x01, 0x8b, 0x9c, 0xb0, 0xfb, 0xee, 0xdd, 0x83, 0x30, 0x63, 0x22, 0x46, 0x92, 0x99,
+    0x21, 0x19, 0xd8, 0x8b, 0xb1, 0x29, 0xd1, 0xe6, 0xe1, 0x29, 0x65, 0x3e, 0x6e, 0x5d, 0x5d, 0x7f,
+    0xba, 0xbc, 0xfb, 0x97, 0x9b, 0xf3, 0xd6, 0xf5, 0x15, 0xb6, 0x14, 0x04, 0xf7, 0x59, 0x50, 0x8b,
+    0xc8, 0x1e, 0x74, 0x1e, 0x72, 0x27, 0x15, 0xbd, 0xc2, 0xe6, 0x08, 0x9f, 0xff, 0xfc, 0x2f, 0x1f,
+    0xde, 0xb0, 0x32, 0xd7, 0x65, 0x61, 0xce, 0x0b, 0xa6, 0xc3, 0x49, 0x32, 0x13, 0x4a, 0x08, 0xef,
+    0x55, 0xc3, 0x5c, 0xb6, 0xa4, 0xed, 0x8b, 0x76, 0x35, 0xa9, 0xbe, 0x2f, 0x60, 0x3c, 0x09, 0xad,
+    0x0c, 0xfd, 0xd8, 0x46, 0x29, 0xec, 0x53, 0x1b, 0x2f, 0x69, 0x19, 0x25, 0xde, 0x07, 0xa4, 0xbf,
+    0x83, 0x45, 0x18, 0x1f, 0x40, 0x21, 0x73, 0x56, 0x57, 0x75, 0x8f, 0xf1, 0xed, 0xe9, 0x0b, 0xba,
+    0x39, 0x09, 0xfb, 0x5c, 0x17, 0x9c, 0x48, 0x7e, 0x71, 0x45, 0xc8, 0xe4, 0x27, 0xf6, 0x57, 0x3f,
+    0x56, 0x02, 0xdf, 0x76, 0xcd, 0xbb, 0x60, 0x91, 0x34, 0x05, 0xf6, 0xb2, 0xc4, 0x28, 0x5a, 0x48,
+    0xbe, 0xb3, 0x7a, 0x01, 0x71, 0xb1, 0x05, 0x0b, 0x33, 0x2a, 0xaf, 0x5c, 0xb1, 0xd4, 0x29, 0x57,
+    0x91, 0x3f, 0x6b, 0x93, 0x6f, 0x62, 0xcf, 0x27, 0x83, 0xf5, 0x4d, 0xa8, 0x59, 0xe8, 0xce, 0xe4,
+    0x63, 0x81, 0xdf, 0x30, 0xf9, 0x05, 0x93, 0xda, 0xdd, 0xa0, 0x27, 0x22, 0x11, 0xc5, 0x16, 0x3c,
+    0xa5, 0xba, 0xc0, 0xec, 0xb9, 0x03, 0x6a, 0xee, 0x53, 0xe8, 0x01, 0xc8, 0x01, 0xf4, 0x1a, 0x36,
+    0x24, 0x13, 0x8f, 0x06, 0x03, 0xcf, 0x9e, 0x7b, 0xb1, 0x2d, 0x0a, 0xcc, 0x8f, 0x44, 0x11, 0x67,
+    0x0e, 0x69, 0x77, 0xd1, 0x1d, 0x13, 0x70, 0x4b, 0xe0, 0x0a, 0x21, 0x7b, 0x3e, 0x87, 0x2b, 0x30,
+    0x68, 0x3d, 0xc6, 0x9f, 0x3a, 0x0a, 0x52, 0xcf, 0x41, 0x62, 0xad, 0x84, 0x18, 0x82, 0x7d, 0x40,
+    0x4a, 0xca, 0x23, 0x7c, 0xde, 0x74, 0x60, 0xa2, 0x25, 0xee, 0xd0, 0x27, 0x79, 0x00, 0x81, 0x57,
+    0x35, 0x7c, 0x97, 0x09, 0x41, 0x92, 0xc1, 0xf3, 0x44, 0x81, 0xca, 0xa5, 0x47, 0xc4, 0x33, 0x68,
+    0x06, 0x0b, 0xb0, 0x9d, 0x87, 0x8a, 0x9b, 0x27, 0xee, 0x57, 0xe0, 0xed, 0x81, 0x3b, 0x67, 0x34,
+    0xa5, 0x8d, 0x95, 0x1e, 0x93, 0x53, 0xc0, 0x72, 0xf9, 0x21, 0x16, 0xcc, 0xfc, 0xfc, 0x1d, 0xb9,
+    0x22, 0x4d, 0x64, 0xe3, 0x03, 0x3e, 0xa9, 0xf8, 0x54, 0x27, 0xa5, 0x90, 0xf7, 0xd1, 0xdc, 0x35,
+    0xa4, 0xd1, 0x7a, 0xf3, 0x11, 0x61, 0x38, 0xa0, 0xae, 0xa1, 0x67, 0x6c, 0x84, 0x38, 0xe8, 0x4e,
+    0x0a, 0xe3, 0x99, 0x65, 0xd1, 0x72, 0x25, 0x58, 0x67, 0x44, 0xd6, 0xa1, 0xa6, 0xd5, 0x39, 0xde,
+    0x3b, 0xc8, 0x71, 0xbf, 0x12, 0x65, 0x04, 0x2b, 0x97, 0xe1, 0x01, 0x86, 0x72, 0x30, 0xab, 0x24,
+    0x11, 0x55, 0x52, 0x8a, 0x3c, 0x11, 0x63, 0x4e, 0x19, 0x72, 0xea, 0x38, 0x81, 0x34, 0x54, 0x18,
+    0xe0, 0x9c, 0xa3, 0xda, 0x95, 0x5e, 0x92, 0x14, 0x4a, 0xb9, 0xa4, 0x50, 0xf3, 0xdf, 0x25, 0x95,
+    0x8a, 0x65, 0xa8, 0xe4, 0xe5, 0x8d, 0x3c, 0x29, 0x57, 0xaa, 0xe0, 0xa0, 0x85, 0x72, 0x2d, 0x27,
+    0x6b, 0x7e, 0x9b, 0x76, 0x99, 0x7d, 0x01, 0x3a, 0x54, 0x78, 0x9b, 0xc5, 0xb9, 0x01, 0x63, 0x1c,
+    0x6a, 0x90, 0x1a, 0x14, 0x37, 0x4f, 0x84, 0x7c, 0x08, 0x89, 0x17, 0xb9, 0xd7, 0x8e, 0x32, 0x06,
+    0x91, 0xa1, 0xa2, 0x2a, 0x31, 0x55, 0x63, 0x25, 0x49, 0x64, 0xf4, 0x05, 0xa9, 0x30, 0xc3, 0x37,
+    0x45, 0xa6, 0x57, 0xd5, 0xdc, 0x52, 0x72, 0x1c, 0x05, 0xd2, 0xbb, 0x30, 0x6e, 0xac, 0xe7, 0x50,
+    0xe4, 0x33, 0xde, 0xa7, 0xf4, 0xe9, 0xbc, 0x03, 0x11, 0x57, 0xab, 0x52, 0x0c, 0xa4, 0x76, 0x8b,
+    0x86, 0x83, 0xa9, 0xf2, 0x3f, 0x49, 0xb2, 0x92, 0x90, 0x6c, 0xbe, 0xb6, 0x12, 0x19, 0x67, 0x00,
+    0x5e, 0x0b, 0x2b, 0x25, 0xca, 0xc4, 0x57, 0x0c, 0x88, 0x07, 0x8c, 0xe7, 0x6c, 0x36, 0x4a, 0x27,
+    0x9a, 0x1f, 0x44, 0xfa, 0xf8, 0xba, 0xa0, 0x96, 0x87, 0xc6, 0xf2, 0xe0, 0xfe, 0xa6, 0xf5, 0x83,
+    0x01, 0x35, 0x4d, 0x02, 0x0d, 0x06, 0x50, 0x88, 0xf8, 0x99, 0xfd, 0x34, 0xc5, 0x95, 0x67, 0xb8,
+    0x53, 0x82, 0x68, 0xc0, 0x69, 0x27, 0x31, 0xa6, 0x8d, 0x61, 0xac, 0xc7, 0xc2, 0xb1, 0x6f, 0x18,
+    0x04, 0xc9, 0xe3, 0x9c, 0xc6, 0x5a, 0xfc, 0x54, 0x81, 0xf3, 0x39, 0xef, 0xea, 0x1b, 0xe9, 0x5a,
+    0x9a, 0x6e, 0x8b, 0x04, 0x76, 0x2c, 0xdf, 0xa7, 0xbb, 0x61, 0x39, 0x95, 0x27, 0x1b, 0x45, 0x51,
+    0x51, 0xa3, 0x64, 0x1e, 0xdf, 0x12, 0x01, 0xf4, 0xb3, 0xdb, 0xce, 0xd4, 0xed, 0xcd, 0xc2, 0x16,
+    0x18, 0xf0, 0x51, 0xb2, 0xd5, 0x27, 0x17, 0xb1, 0x7b, 0x2e, 0x40, 0xd6, 0x0c, 0xe3, 0x10, 0x9b,
+    0xa5, 0x53, 0x60, 0x8e, 0xda, 0x14, 0xaa, 0x90, 0x38, 0xf1, 0x86, 0xba, 0x23, 0x4a, 0xaf, 0x42,
+    0x65, 0xbb, 0x45, 0xf9, 0x2f, 0xb6, 0x00, 0xf4, 0x80, 0x76, 0xb4, 0x81, 0x19, 0x28, 0xe9, 0x33,
+    0x94, 0xf8, 0xf6, 0x0f, 0x03, 0x1b, 0x36, 0x15, 0x20, 0xbf, 0xf2, 0x8a, 0x83, 0xac, 0x5c, 0x9e,
+    0x6f, 0xc6, 0x5e, 0x82, 0x1c, 0x3f, 0xa8, 0x02, 0x34, 0xfe, 0x73, 0x22, 0xa2, 0xbc, 0xec, 0x70,
+    0x8a, 0xbb, 0x21, 0xe8, 0xcd, 0x63, 0x96, 0x92, 0xc3, 0x9e, 0xe8, 0xf5, 0x87, 0x78, 0x79, 0xdc,
+    0x37, 0xd2, 0xa0, 0xe7, 0x18, 0xd0, 0xc0, 0x5c, 0x7c, 0xba, 0xba, 0xce, 0xe6, 0xd7, 0xf0, 0xa6,
+    0x9b, 0x7a, 0x20, 0xfa, 0x94, 0x64, 0xa5, 0x3d, 0x54, 0xec, 0x6c, 0xb3, 0x00, 0x82, 0x3b, 0x2e,
+    0x26, 0xda, 0xe1, 0x75, 0x6c, 0x0f, 0xa0, 0xdf, 0xc9, 0xaf, 0xe1, 0x9d, 0x78, 0x9d, 0xf0, 0x2d,
+    0x98, 0xcf, 0xb7, 0x9d, 0xac, 0x33, 0x11, 0x47, 0x3f, 0x6b, 0x33, 0x59, 0x0a, 0xa3, 0x9e, 0xc2,
+    0xe9, 0xa3, 0x57, 0xf8, 0x3d, 0x67, 0x24, 0xfd, 0x33, 0x7b, 0xc8, 0x80, 0x5d, 0x08, 0x84, 0x81,
+    0x0d, 0x51, 0x42, 0xa0, 0xe9, 0x92, 0xb7, 0x11, 0xc1, 0x1b, 0xe0, 0x2e, 0x2b, 0x6f, 0xfd, 0xb3,
+    0xf3, 0x46, 0x36, 0x89, 0xfd, 0x91, 0xf6, 0x4c, 0x68, 0x97, 0xda, 0x94, 0x59, 0x24, 0xba, 0xc7,
+    0xe0, 0x98, 0xbc, 0xdd, 0x10, 0xe7, 0x0a, 0x8b, 0x1d, 0xcb, 0xeb, 0x49, 0xe4, 0x16, 0x7a, 0xb8,
+    0xe8, 0xba, 0x43, 0x76, 0xb3, 0x3a, 0xde, 0xe8, 0x7b, 0x96, 0x92, 0x3d, 0xa2, 0xde, 0xf7, 0xbf,
+    0x43, 0x69, 0xa6, 0x03, 0xc2, 0x21, 0xa8, 0xfd, 0x21, 0x9b, 0x43, 0xa8, 0x45, 0x43, 0x48, 0x1a,
+    0x68, 0x07, 0x92, 0xb4, 0x03, 0xc1, 0x15, 0xe3, 0x6c, 0x86, 0x57, 0x2a, 0x85, 0x42, 0x21, 0xad,
+    0x98, 0xc5, 0x63, 0xc5, 0xd8, 0xdd, 0x46, 0x9a, 0x3b, 0x1c, 0x55, 0x93, 0x4a, 0x7f, 0x1a, 0x78,
+    0xdf, 0xff, 0x47, 0xef, 0x03, 0xca, 0x13, 0xf0, 0x0a, 0xbd, 0x86, 0x4f, 0xa4, 0x0c, 0x82, 0x7f,
+    0x2e, 0x4b, 0xe1, 0x19, 0x19, 0xe8, 0x8b, 0x24, 0xe0, 0x77, 0x2c, 0x23, 0xe6, 0x19, 0xe1, 0x82,
+    0x5d, 0xc4, 0x7c, 0x7a, 0x99, 0x44, 0xe9, 0xab, 0xa0, 0xb4, 0x58, 0xa9, 0x8b, 0x21, 0xbc, 0xd1,
+    0x23, 0x47, 0x2c, 0x38, 0x1e, 0xb4, 0x53, 0x46, 0x78, 0x71, 0x90, 0x88, 0x6c, 0xb6, 0x4a, 0x30,
+    0xde, 0xe0, 0x3d, 0xe3, 0xd6, 0x92, 0x0d, 0xf3, 0xfb, 0xdf, 0x07, 0x9d, 0x00, 0x9c, 0xcb, 0xa3,
+    0x2c, 0xf0, 0x13, 0x4e, 0x35, 0x6f, 0xe5, 0xf0, 0xec, 0x21, 0x94, 0x2b, 0xde, 0x5f, 0xaf, 0xa0,
+    0xd9, 0x01, 0x87, 0x05, 0xd5, 0xe9, 0x3d, 0x13, 0x76, 0x93, 0x8b, 0x9e, 0xba, 0xa8, 0xbb, 0x38,
+    0xfd, 0xd7, 0x6b, 0xe0, 0x95, 0x67, 0xcd, 0xfc, 0x24, 0x8b, 0x9f, 0x20, 0x07, 0xc8, 0x2c, 0x36,
+    0x4a, 0x59, 0xc3, 0x19, 0xd9, 0x58, 0x3a, 0x20, 0x37, 0x64, 0xf9, 0x59, 0x65, 0x6a, 0x7e, 0x88,
+    0xbf, 0x1a, 0x9f, 0xe0, 0x6c, 0x4a, 0xe4, 0x6f, 0x52, 0xe4, 0x9f, 0xa6, 0x1c, 0x05, 0xe0, 0x7c,
+    0x10, 0x68, 0x56, 0x0f, 0x07, 0x5c, 0xea, 0xe1, 0x6f, 0x88, 0x66, 0x3f, 0x7f, 0x5b, 0x9a, 0x2b,
+    0x96, 0xf1, 0x02, 0xe1, 0xad, 0xf7, 0x97, 0x2c, 0x95, 0xbd, 0x00, 0x9f, 0xec, 0x50, 0xf2, 0x59,
+    0xac, 0xb1, 0xc4, 0x29, 0x57, 0xd3, 0x1c, 0xb8, 0x81, 0xc3, 0x9d, 0x65, 0x21, 0xb7, 0x48, 0xaf,
+    0x24, 0x50, 0x96, 0x88, 0xac, 0xf8, 0x29, 0xb2, 0x91, 0x1b, 0xac, 0x26, 0x1f, 0x41, 0x2f, 0x57,
+    0x0e, 0xc6, 0xb2, 0x66, 0x9a, 0xb0, 0x9b, 0x0b, 0x88, 0x22, 0x15, 0x13, 0x6a, 0x9c, 0x1a, 0x33,
+    0xb2, 0x27, 0xc7, 0x74, 0xc7, 0x72, 0xf9, 0xef, 0x7a, 0x0c, 0x7e, 0x14, 0xdb, 0x7d, 0x62, 0x2e,
+    0x3f, 0xad, 0xcd, 0xce, 0xf2, 0xa0, 0x4f, 0xb1, 0xaa, 0x21, 0x7f, 0x91, 0x74, 0xe6, 0x43, 0xbf,
+    0xc9, 0xcf, 0xbb, 0x62, 0x67, 0xbc, 0x33, 0xe2, 0x43, 0xf7, 0x14, 0x4b, 0x44, 0xdf, 0x5e, 0x2d,
+    0x8a, 0xd8, 0x0e, 0x66, 0x5f, 0xe4, 0xd9, 0x75, 0x7e, 0x54, 0x2c, 0x2e, 0x6d, 0xc4, 0xd1, 0xc9,
+    0xf2, 0xf0, 0x49, 0x06, 0xcc, 0x2c, 0x7e, 0x3e, 0x37, 0xf7, 0xfc, 0xe8, 0xf4, 0x4e, 0x1c, 0x82,
+    0x0a, 0x9f, 0x5e, 0x71, 0x0c, 0x1a, 0xe3, 0xcc, 0xf2, 0xbb, 0x79, 0x7e, 0xa7, 0x1c, 0x3b, 0x2e,
+    0x12, 0x97, 0x15, 0xcf, 0x6c, 0xba, 0xe6, 0x01, 0x23, 0x7f, 0x7c, 0xc6, 0xaf, 0xe8, 0xce, 0xc5,
+    0x56, 0x4d, 0xce, 0x72, 0xd9, 0x90, 0x70, 0x04, 0x94, 0xec, 0x7f, 0x60, 0xe1, 0x68, 0x86, 0xff,
+    0x08, 0xad, 0x20, 0x4f, 0x9d, 0x90, 0x04, 0x36, 0x9f, 0xb8, 0x1d, 0x0d, 0xc5, 0x8c, 0x49, 0x13,
+    0x2d, 0x1a, 0x3b, 0xcc, 0x0c, 0xc1, 0xe4, 0x11, 0xc9, 0x0a, 0xa2, 0xf8, 0x6b, 0xbb, 0xec, 0xfc,
+    0x98, 0x64, 0x7b, 0x5d, 0x5e, 0x1d, 0xae, 0x6d, 0xaf, 0xcb, 0x5f, 0xbd, 0xad, 0xf3, 0xff, 0x49,
+    0xec, 0xff, 0x00, 0x03, 0xa6, 0x59, 0x53, 0x34, 0x36, 0x00, 0x00,
+};
@@ -14,6 +14,9 @@ public:
     bool isConnected();
     String getSSID();
     String getIP();
+    // Ohne String-Allokation (für JSON-Antworten)
+    size_t copySSID(char *out, size_t len);
+    size_t copyIP(char *out, size_t len);
     int getRSSI();
     void reset();
     
@@ -0,0 +1,286 @@
+#include "diagnostics.h"
+#include "json_writer.h"
+#include <esp_attr.h>
+#include <esp_system.h>
+#include <esp_task_wdt.h>
+#include <esp_idf_version.h>
+#include <time.h>
+
+Diagnostics diagnostics;
+
+// Zeitbudget je Abschnitt in ms (0 = nicht geprüft)
+static const uint16_t STAGE_BUDGET_MS[] = {
+    0,      // Setup (WiFiManager-Portal darf warten)
+    0,      // Idle (ulTaskNotifyTake, max. 10 ms)
+    100,    // Web: vorgemerkte Aktionen, WebSocket-Push
+    300,    // Button: Moduswechsel inkl. Zeichnen
+    100,    // Ota
+    100,    // Panel: OTA-Fortschritt / DDP-Frame
+    100,    // Display
+    50,     // Weather: startet nur den Task
+    200,    // WiFi
+    100,    // Https: Leerlauf-Verbindungen schließen
+    50,     // Brightness
+    300,    // Settings: NVS-Schreiben
+    100,    // Animation
+    100,    // History: NVS-Sicherung alle 6 h
+};
+
+static const char *const STAGE_NAMES[] = {
+    "setup", "idle", "web", "button", "ota", "panel", "display",
+    "weather", "wifi", "https", "brightness", "settings", "animation", "history",
+};
+static const char *const EVENT_NAMES[] = {
+    "boot", "restart", "mode", "fetch", "heap_low", "stall", "wifi_lost",
+};
+static const char *const FETCH_NAMES[] = {"weather", "ota_check", "ota_image"};
+
+// ------------------------------------------------------
+// Flugschreiber im RTC-Speicher (wird beim Start nicht genullt)
+// ------------------------------------------------------
+struct FlightRecorder {
+    uint32_t magic;
+    uint16_t boot;
+    uint8_t head;
+    uint8_t count;
+    uint8_t stage;            // aktueller Abschnitt des Haupt-loops
+    uint32_t stageSince;      // millis() beim Betreten
+    DiagRecord events[DIAG_EVENT_COUNT];
+};
+// Layoutänderung (neue Firmware) → alter Inhalt wird verworfen
+#define DIAG_MAGIC (0x46524543u ^ (uint32_t)sizeof(FlightRecorder))
+static RTC_NOINIT_ATTR FlightRecorder recorder;
+
+static uint32_t currentTime() {
+    time_t now = time(nullptr);
+    return now > 1600000000 ? (uint32_t)now : 0;
+}
+
+void Diagnostics::begin() {
+    static_assert(sizeof(STAGE_BUDGET_MS) / sizeof(STAGE_BUDGET_MS[0]) == (size_t)DiagStage::COUNT, "STAGE_BUDGET_MS unvollständig");
+    static_assert(sizeof(STAGE_NAMES) / sizeof(STAGE_NAMES[0]) == (size_t)DiagStage::COUNT, "STAGE_NAMES unvollständig");
+    static_assert(sizeof(EVENT_NAMES) / sizeof(EVENT_NAMES[0]) == (size_t)DiagEvent::COUNT, "EVENT_NAMES unvollständig");
+
+    resetReason = (uint8_t)esp_reset_reason();
+    // Nach dem Einschalten steht Zufall im RTC-Speicher
+    bool valid = resetReason != ESP_RST_POWERON && recorder.magic == DIAG_MAGIC &&
+                 recorder.head < DIAG_EVENT_COUNT && recorder.count <= DIAG_EVENT_COUNT &&
+                 recorder.stage < (uint8_t)DiagStage::COUNT;
+    if (!valid) {
+        memset(&recorder, 0, sizeof(recorder));
+        recorder.magic = DIAG_MAGIC;
+    }
+    resetStage = recorder.stage;
+    recorder.boot++;
+    recorder.stage = (uint8_t)DiagStage::Setup;
+    recorder.stageSince = millis();
+    record(DiagEvent::Boot, resetReason, valid ? resetStage : -1);
+
+    esp_register_shutdown_handler(onShutdown);
+
+    // Arduino startet den Task-Watchdog ohne Panic → hier mit Reset konfigurieren
+#if ESP_IDF_VERSION_MAJOR >= 5
+    esp_task_wdt_config_t config = {DIAG_WDT_TIMEOUT_S * 1000, 1 << 0, true};
+    esp_task_wdt_reconfigure(&config);
+#else
+    esp_task_wdt_init(DIAG_WDT_TIMEOUT_S, true);
+#endif
+
+    printReport();
+}
+
+void Diagnostics::watchCurrentTask() {
+    esp_task_wdt_add(NULL);
+}
+
+void Diagnostics::feed() {
+    esp_task_wdt_reset();
+}
+
+// esp_restart() (Web, OTA, WLAN-Reset) → Abschnitt für den nächsten Start festhalten
+void Diagnostics::onShutdown() {
+    diagnostics.record(DiagEvent::Restart, recorder.stage, 0);
+}
+
+// ------------------------------------------------------
+// Hänger-Erkennung (Haupt-Task)
+// ------------------------------------------------------
+void Diagnostics::stage(DiagStage next) {
+    uint32_t now = millis();
+    uint8_t current = recorder.stage;
+    uint32_t elapsed = now - recorder.stageSince;
+    if (current < (uint8_t)DiagStage::COUNT && STAGE_BUDGET_MS[current] && elapsed > STAGE_BUDGET_MS[current]) {
+        stalls[current]++;
+        record(DiagEvent::Stall, current, elapsed);
+    }
+    recorder.stage = (uint8_t)next;
+    recorder.stageSince = now;
+}
+
+void Diagnostics::loop() {
+    if (millis() - lastHeapCheck < 1000) return;
+    lastHeapCheck = millis();
+
+    // Hysterese: erst wieder melden, wenn sich der Heap deutlich erholt hat
+    uint32_t freeHeap = ESP.getFreeHeap();
+    if (!heapLow && freeHeap < DIAG_HEAP_LOW_BYTES) {
+        heapLow = true;
+        record(DiagEvent::HeapLow, 0, freeHeap);
+    } else if (heapLow && freeHeap > DIAG_HEAP_LOW_BYTES + DIAG_HEAP_LOW_BYTES / 4) {
+        heapLow = false;
+    }
+}
+
+void Diagnostics::recordFetch(FetchSource source, uint32_t ms, bool ok) {
+    record(DiagEvent::Fetch, (uint8_t)source, ok ? (int32_t)ms : -(int32_t)ms);
+    // Firmware-Download dauert regulär länger als das Budget
+    if (source != FetchSource::OtaImage && ms > DIAG_FETCH_BUDGET_MS) {
+        DiagStage owner = source == FetchSource::Weather ? DiagStage::Weather : DiagStage::Ota;
+        stalls[(uint8_t)owner]++;
+        record(DiagEvent::Stall, (uint8_t)owner, ms);
+    }
+}
+
+// ------------------------------------------------------
+// Ring (beliebiger Task)
+// ------------------------------------------------------
+void Diagnostics::record(DiagEvent type, uint8_t detail, int32_t arg) {
+    uint32_t ms = millis();
+    uint32_t now = currentTime();
+
+    portENTER_CRITICAL(&mux);
+    DiagRecord *last = recorder.count
+        ? &recorder.events[(recorder.head + DIAG_EVENT_COUNT - 1) % DIAG_EVENT_COUNT]
+        : nullptr;
+    // Wiederholungen (z. B. WLAN weg alle 5 s) zusammenfassen, damit der Ring
+    // nicht von einem Dauerzustand überschrieben wird
+    if (last && type != DiagEvent::Boot && last->boot == recorder.boot && last->type == type &&
+        last->detail == detail && (last->arg < 0) == (arg < 0)) {
+        if (last->repeat < UINT16_MAX) last->repeat++;
+        // Hänger: längste Dauer behalten, sonst den neuesten Wert
+        if (type != DiagEvent::Stall || arg > last->arg) last->arg = arg;
+        last->ms = ms;
+        last->time = now;
+    } else {
+        DiagRecord &r = recorder.events[recorder.head];
+        r.time = now;
+        r.ms = ms;
+        r.arg = arg;
+        r.boot = recorder.boot;
+        r.repeat = 1;
+        r.type = type;
+        r.detail = detail;
+        recorder.head = (recorder.head + 1) % DIAG_EVENT_COUNT;
+        if (recorder.count < DIAG_EVENT_COUNT) recorder.count++;
+    }
+    portEXIT_CRITICAL(&mux);
+}
+
+// ------------------------------------------------------
+// Ausgabe
+// ------------------------------------------------------
+size_t Diagnostics::describe(const DiagRecord &r, char *out, size_t len) {
+    int n;
+    switch (r.type) {
+    case DiagEvent::Boot:   // "task_wdt/display": Grund und Abschnitt beim Reset
+        n = r.arg >= 0 ? snprintf(out, len, "%s/%s", resetReasonName(r.detail), stageName((DiagStage)r.arg))
+                       : snprintf(out, len, "%s", resetReasonName(r.detail));
+        break;
+    case DiagEvent::Restart:
+    case DiagEvent::Stall:
+        n = snprintf(out, len, "%s", stageName((DiagStage)r.detail));
+        break;
+    case DiagEvent::Fetch:
+        n = snprintf(out, len, "%s", r.detail < (uint8_t)FetchSource::COUNT ? FETCH_NAMES[r.detail] : "?");
+        break;
+    case DiagEvent::Mode:
+        n = snprintf(out, len, "%u", r.detail);
+        break;
+    default:
+        n = snprintf(out, len, "%s", "");
+        break;
+    }
+    return n > 0 ? (size_t)n : 0;
+}
+
+void Diagnostics::printReport() const {
+    Serial.printf("[Diag] Start #%u, Reset: %s", recorder.boot, resetReasonName(resetReason));
+    if (resetReason != ESP_RST_POWERON) Serial.printf(" (Abschnitt: %s)", stageName((DiagStage)resetStage));
+    Serial.println();
+
+    // Nur Ereignisse früherer Starts: die aktuellen stehen ohnehin im Log
+    char detail[24];
+    for (uint8_t i = 0; i < recorder.count; ++i) {
+        const DiagRecord &r = recorder.events[(recorder.head + DIAG_EVENT_COUNT - recorder.count + i) % DIAG_EVENT_COUNT];
+        if (r.boot == recorder.boot) continue;
+        describe(r, detail, sizeof(detail));
+        Serial.printf("[Diag]   #%u %7lu ms  %-9s %-10s %ld", r.boot, (unsigned long)r.ms, eventName(r.type), detail, (long)r.arg);
+        if (r.repeat > 1) Serial.printf("  ×%u", r.repeat);
+        Serial.println();
+    }
+}
+
+size_t Diagnostics::serialize(char *out, size_t len) const {
+    JsonWriter json(out, len);
+    json.beginObject()
+        .add("boot", recorder.boot)
+        .add("resetReason", resetReasonName(resetReason))
+        .add("resetStage", resetReason != ESP_RST_POWERON ? stageName((DiagStage)resetStage) : "");
+    json.beginObject("stalls");
+    for (uint8_t s = 0; s < (uint8_t)DiagStage::COUNT; ++s) {
+        if (STAGE_BUDGET_MS[s]) json.add(STAGE_NAMES[s], stalls[s]);
+    }
+    json.endObject();
+
+    portENTER_CRITICAL(&mux);
+    uint8_t count = recorder.count;
+    uint8_t first = (recorder.head + DIAG_EVENT_COUNT - count) % DIAG_EVENT_COUNT;
+    portEXIT_CRITICAL(&mux);
+
+    // älteste zuerst
+    json.beginArray("events");
+    char detail[24];
+    for (uint8_t i = 0; i < count; ++i) {
+        portENTER_CRITICAL(&mux);
+        DiagRecord r = recorder.events[(first + i) % DIAG_EVENT_COUNT];
+        portEXIT_CRITICAL(&mux);
+
+        describe(r, detail, sizeof(detail));
+        json.beginObject()
+            .add("boot", r.boot)
+            .add("time", r.time)
+            .add("ms", r.ms)
+            .add("type", eventName(r.type))
+            .add("detail", detail)
+            .add("arg", r.arg)
+            .add("repeat", r.repeat)
+            .endObject();
+    }
+    json.endArray();
+    json.endObject();
+    return json.ok() ? json.length() : 0;
+}
+
+const char *Diagnostics::stageName(DiagStage s) {
+    return s < DiagStage::COUNT ? STAGE_NAMES[(uint8_t)s] : "?";
+}
+
+const char *Diagnostics::eventName(DiagEvent e) {
+    return e < DiagEvent::COUNT ? EVENT_NAMES[(uint8_t)e] : "?";
+}
+
+const char *Diagnostics::resetReasonName(uint8_t reason) {
+    switch ((esp_reset_reason_t)reason) {
+    case ESP_RST_POWERON: return "poweron";
+    case ESP_RST_EXT: return "external";
+    case ESP_RST_SW: return "software";
+    case ESP_RST_PANIC: return "panic";
+    case ESP_RST_INT_WDT: return "int_wdt";
+    case ESP_RST_TASK_WDT: return "task_wdt";
+    case ESP_RST_WDT: return "wdt";
+    case ESP_RST_DEEPSLEEP: return "deepsleep";
+    case ESP_RST_BROWNOUT: return "brownout";
+    case ESP_RST_SDIO: return "sdio";
+    default: return "unknown";
+    }
+}
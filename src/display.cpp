@@ -2,6 +2,10 @@
 #include "config.h"
 #include "font.h"
 #include "settings_manager.h"
+#include "metrics.h"
+#include "logger.h"
+#include "profiler.h"
+#include "power_governor.h"
 #include <Arduino.h>
 #include <math.h>
 
@@ -115,13 +119,38 @@ static const size_t fog_lines_len = sizeof(fog_lines) / sizeof(fog_lines[0]);
 
 #undef P
 
+// ------------------------------------------------------
+// Icon-Tabelle: indiziert über WeatherCondition
+// - bis zu zwei Template-Ebenen pro Icon, optional gestreut (Nebel)
+// - Eintrag ohne Ebenen → Temperatur als Fallback
+// ------------------------------------------------------
+struct WeatherIcon {
+    const uint8_t (*layer1)[2];
+    size_t len1;
+    const uint8_t (*layer2)[2];
+    size_t len2;
+    bool dither;
+};
+
+static const WeatherIcon weatherIcons[(uint8_t)WeatherCondition::COUNT] = {
+    /* Unknown */ {nullptr, 0, nullptr, 0, false},
+    /* Clear   */ {sun_core, sun_core_len, sun_rays, sun_rays_len, false},
+    /* Cloud   */ {cloud_outline, cloud_outline_len, nullptr, 0, false},
+    /* Rain    */ {cloud_base, cloud_base_len, rain_drops, rain_drops_len, false},
+    /* Snow    */ {cloud_base, cloud_base_len, snowflakes, snowflakes_len, false},
+    /* Thunder */ {cloud_base, cloud_base_len, lightning, lightning_len, false},
+    /* Fog     */ {fog_lines, fog_lines_len, nullptr, 0, true},
+};
+
 // ------------------------------------------------------
 // Interne Hilfsfunktionen (nicht in Header exportiert)
 // ------------------------------------------------------
-static inline void drawTemplateFromProgmem(const uint8_t template_xy[][2], size_t len) {
+static inline void drawTemplateFromProgmem(const uint8_t template_xy[][2], size_t len, bool dither = false) {
     for (size_t i = 0; i < len; ++i) {
         uint8_t x = pgm_read_byte(&template_xy[i][0]);
         uint8_t y = pgm_read_byte(&template_xy[i][1]);
+        // Streuung: nur manche Pixel
+        if (dither && (x + y) % 3 == 0) continue;
         display.setPixel(x, y, true);
     }
 }
@@ -137,28 +166,26 @@ Display::Display() : brightness(200), animationActive(false), animationFrame(0)
 // begin(): Pins, brightness from settings, startup animation
 // ------------------------------------------------------
 void Display::begin() {
-    Serial.println("[Display] Initialisiere Display...");
+    LOG_INFO(Display, "Initialisiere Display...");
 
-    pinMode(P_EN, OUTPUT);
     pinMode(P_DI, OUTPUT);
     pinMode(P_CLK, OUTPUT);
     pinMode(P_CLA, OUTPUT);
 
-    digitalWrite(P_EN, LOW);
     digitalWrite(P_CLA, LOW);
     digitalWrite(P_CLK, LOW);
     digitalWrite(P_DI, LOW);
 
-    // Brightness aus Settings übernehmen (wie ursprünglich)
+    // Brightness aus Settings übernehmen; P_EN gehört ab hier der LEDC
     brightness = settingsManager.getBrightness();
-    setBrightness(brightness); // <-- aktiv steuern!
-    Serial.println("[Display] Übernommene Brightness: " + String(brightness));
+    dimmer.begin(P_EN, brightness);
+    LOG_INFO(Display, "Übernommene Brightness: %d", brightness);
 
     clear();
     update();
     startupAnimation();
 
-    Serial.println("[Display] Initialisierung abgeschlossen");
+    LOG_INFO(Display, "Initialisierung abgeschlossen");
 }
 
 // ------------------------------------------------------
@@ -169,19 +196,13 @@ void Display::clear() {
 }
 
 void Display::setBrightness(uint8_t b) {
-    brightness = constrain(b, 0, 255);
-
-    // PWM-Invertierung (0 = hell, 255 = aus)
-    uint8_t pwmValue = 255 - brightness;
+    brightness = b;
+    dimmer.set(b);
+}
 
-#if defined(ESP32)
-    // ESP32 PWM über LEDC
-    ledcAttachPin(P_EN, 0);
-    ledcSetup(0, 5000, 8);  // Kanal 0, 5 kHz, 8 Bit
-    ledcWrite(0, pwmValue);
-#else
-    analogWrite(P_EN, pwmValue);
-#endif
+void Display::fadeBrightness(uint8_t b, uint16_t ms) {
+    brightness = b;
+    dimmer.fadeTo(b, ms);
 }
 
 void Display::setPixel(uint8_t x, uint8_t y, bool state) {
@@ -202,15 +223,32 @@ int Display::mapToHardwareIndex(uint8_t x, uint8_t y) {
 // Low-level shift / latch / update
 // ------------------------------------------------------
 void Display::shiftOut() {
+    PROFILE_ZONE("Display::shiftOut");
     // lokal speichern, um direkten Zugriff auf framebuffer einmalig zu machen
     bool hardwareBuffer[256];
     memset(hardwareBuffer, 0, sizeof(hardwareBuffer));
 
+    // gleichzeitig gepackten Spiegel erzeugen (Zeile = 2 Byte, MSB = links)
     for (uint8_t y = 0; y < 16; ++y) {
+        uint16_t row = 0;
         for (uint8_t x = 0; x < 16; ++x) {
             int hwIndex = mapToHardwareIndex(x, y);
-            hardwareBuffer[hwIndex] = framebuffer[y][x] > 0;
+            bool on = framebuffer[y][x] > 0;
+            hardwareBuffer[hwIndex] = on;
+            row = (row << 1) | on;
         }
+#ifdef ROTATE_DISPLAY
+        // setPixel() dreht um 180° → für den Betrachter zurückdrehen
+        row = __builtin_bswap16(row);
+        row = ((row & 0xF0F0) >> 4) | ((row & 0x0F0F) << 4);
+        row = ((row & 0xCCCC) >> 2) | ((row & 0x3333) << 2);
+        row = ((row & 0xAAAA) >> 1) | ((row & 0x5555) << 1);
+        uint8_t py = 15 - y;
+#else
+        uint8_t py = y;
+#endif
+        presented[py * 2] = row >> 8;
+        presented[py * 2 + 1] = row & 0xFF;
     }
 
     for (int i = 0; i < 256; ++i) {
@@ -230,8 +268,13 @@ void Display::latch() {
 }
 
 void Display::update() {
+    uint32_t t0 = micros();
     shiftOut();
+    // Strombudget vor dem Latch prüfen: ein dichter Frame erscheint nie über dem Budget
+    powerGovernor.onFrame(presented, dimmer);
     latch();
+    presentedCount++;
+    metrics.observeDisplayPush(micros() - t0);
 }
 
 // ------------------------------------------------------
@@ -332,18 +375,18 @@ void Display::handleAsyncAnimation() {
 }
 
 void Display::startupAnimation() {
-    Serial.println("[Display] Startanimation: Stripe Sweep mit Kreis-Fadeout");
+    LOG_DEBUG(Display, "Startanimation: Stripe Sweep mit Kreis-Fadeout");
 
     clear(); update();
     const int speed = 30;
 
     // Horizontaler Sweep
+    showBrightness(150);
     for (int step = 0; step <= 16; ++step) {
         clear();
         for (int y = 0; y < 16; ++y)
             for (int x = 0; x < step; ++x)
                 if ((x + y) % 2 == 0) setPixel(x, y, true);
-        setBrightness(150);
         update();
         delay(speed);
     }
@@ -355,33 +398,34 @@ void Display::startupAnimation() {
             for (int x = 0; x < 16; ++x)
                 if ((x + y + frame) % 8 < 3) setPixel(x, y, true);
         int b = 120 + (int)(80 * sin(frame * 0.4f));
-        setBrightness((uint8_t)b);
+        showBrightness((uint8_t)b);
         update();
         delay(speed);
     }
 
     // Vertikale Lichtflut (unten -> oben)
+    showBrightness(180);
     for (int step = 15; step >= 0; --step) {
         clear();
         for (int y = step; y < 16; ++y)
             for (int x = 0; x < 16; ++x)
                 if ((x + y + step) % 3 < 2) setPixel(x, y, true);
-        setBrightness(180);
         update();
         delay(speed);
     }
 
-    // Kurzer Aufblitz
+    // Kurzer Aufblitz (Hardware-Fade, delay() hält nur den Takt)
     for (int i = 0; i < 2; ++i) {
-        setBrightness(255); update(); delay(80);
-        setBrightness(100); update(); delay(80);
+        flashBrightness(255, 100, 160);
+        delay(160);
     }
 
     // Kreisförmiges Ausblenden
     fadeOutCircle();
 
     clear(); update();
-    Serial.println("[Display] Startanimation abgeschlossen (Kreis-Fadeout)");
+    restoreBrightness(0);
+    LOG_DEBUG(Display, "Startanimation abgeschlossen (Kreis-Fadeout)");
 }
 
 void Display::fadeOutCircle() {
@@ -422,12 +466,12 @@ void Display::circleAnimation() {
 }
 
 void Display::lineAnimation() {
+    showBrightness(150);
     for (int step = 0; step <= 16; ++step) {
         clear();
         for (int y = 0; y < 16; ++y)
             for (int x = 0; x < step; ++x)
                 if ((x + y) % 2 == 0) setPixel(x, y, true);
-        setBrightness(150);
         update();
         delay(30);
     }
@@ -436,10 +480,10 @@ void Display::lineAnimation() {
         for (int y = 0; y < 16; ++y)
             for (int x = 0; x < step; ++x)
                 if ((x + y) % 2 == 0) setPixel(x, y, true);
-        setBrightness(150);
         update();
         delay(30);
     }
+    restoreBrightness();
 }
 
 // ------------------------------------------------------
@@ -465,21 +509,19 @@ void Display::animateCheckmark() {
         update();
         delay(60);
     }
+    // Zweimal aufblitzen; zurück zur globalen Helligkeit geht es von selbst
     for (int i = 0; i < 2; ++i) {
-        setBrightness(255); update(); delay(80);
-        setBrightness(150); update(); delay(80);
+        flashBrightness(255, 150, 160);
+        delay(160);
     }
-
-    brightness = settingsManager.getBrightness();
-    setBrightness(brightness);
 }
 
 // ------------------------------------------------------
 // Wetteranzeige (modularisiert)
 // - drawWeather(temp, cond, mode)
-// - Icons nutzen Templates oben, weniger Duplikation
+// - Icons über weatherIcons[cond], keine String-Suche pro Frame
 // ------------------------------------------------------
-void Display::drawWeather(float temp, const String &cond, WeatherMode mode) {
+void Display::drawWeather(float temp, WeatherCondition cond, WeatherMode mode) {
     clear();
 
     if (mode == WeatherMode::MODE_TEXT) {
@@ -508,38 +550,14 @@ void Display::drawWeather(float temp, const String &cond, WeatherMode mode) {
         }
 
     } else { // MODE_ICON
-        // Entscheide Icon anhand cond-String (cases ähnlich wie original)
-        if (cond.indexOf("Cloud") >= 0 && cond.indexOf("Rain") < 0 && cond.indexOf("Snow") < 0) {
-            // wolken-icon (outline)
-            drawTemplateFromProgmem(cloud_outline, cloud_outline_len);
-        }
-        else if (cond.indexOf("Rain") >= 0) {
-            drawTemplateFromProgmem(cloud_base, cloud_base_len);
-            drawTemplateFromProgmem(rain_drops, rain_drops_len);
-        }
-        else if (cond.indexOf("Snow") >= 0) {
-            drawTemplateFromProgmem(cloud_base, cloud_base_len);
-            drawTemplateFromProgmem(snowflakes, snowflakes_len);
-        }
-        else if (cond.indexOf("Thunder") >= 0 || cond.indexOf("Storm") >= 0) {
-            drawTemplateFromProgmem(cloud_base, cloud_base_len);
-            drawTemplateFromProgmem(lightning, lightning_len);
-        }
-        else if (cond.indexOf("Clear") >= 0 || cond.indexOf("Sunny") >= 0) {
-            drawTemplateFromProgmem(sun_core, sun_core_len);
-            drawTemplateFromProgmem(sun_rays, sun_rays_len);
-        }
-        else if (cond.indexOf("Fog") >= 0 || cond.indexOf("Mist") >= 0 || cond.indexOf("Haze") >= 0) {
-            // Nebel: mehrere horizontale Linien (leicht versetzt)
-            for (size_t i = 0; i < fog_lines_len; ++i) {
-                uint8_t x = pgm_read_byte(&fog_lines[i][0]);
-                uint8_t y = pgm_read_byte(&fog_lines[i][1]);
-                // Streuung: nur manche Pixel
-                if ((x + y) % 3 != 0) setPixel(x, y, true);
-            }
-        }
-        else {
-            // Fallback: zeige Temperatur als Text, wenn Icon nicht matcht
+        uint8_t idx = (uint8_t)cond;
+        const WeatherIcon &icon = weatherIcons[idx < (uint8_t)WeatherCondition::COUNT ? idx : 0];
+
+        if (icon.layer1) {
+            drawTemplateFromProgmem(icon.layer1, icon.len1, icon.dither);
+            if (icon.layer2) drawTemplateFromProgmem(icon.layer2, icon.len2, icon.dither);
+        } else {
+            // Fallback: zeige Temperatur als Text, wenn kein Icon vorhanden
             int t = roundf(temp);
             if (abs(t) >= 10) {
                 drawDigit(abs(t) / 10, 2, 4);
@@ -554,6 +572,28 @@ void Display::drawWeather(float temp, const String &cond, WeatherMode mode) {
     update();
 }
 
+// ------------------------------------------------------
+// Spaltengrafik: vorberechnete Bitmasken direkt übernehmen
+// ------------------------------------------------------
+void Display::drawColumns(const uint16_t columns[16]) {
+    clear();
+    for (uint8_t x = 0; x < 16; ++x) {
+        uint16_t col = columns[x];
+        for (uint8_t y = 0; col; ++y, col >>= 1)
+            if (col & 1) setPixel(x, y, true);
+    }
+    update();
+}
+
+void Display::drawBitmap(const uint8_t bits[32]) {
+    for (uint8_t y = 0; y < 16; ++y) {
+        uint16_t row = ((uint16_t)bits[y * 2] << 8) | bits[y * 2 + 1];
+        for (uint8_t x = 0; x < 16; ++x)
+            setPixel(x, y, row & (0x8000 >> x));
+    }
+    update();
+}
+
 // ------------------------------------------------------
 // Ende der Datei
 // ------------------------------------------------------
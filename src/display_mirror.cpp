@@ -0,0 +1,64 @@
+#include "display_mirror.h"
+#include "display.h"
+
+DisplayMirror displayMirror;
+
+DisplayMirror::DisplayMirror() : ws("/ws/display") {}
+
+void DisplayMirror::begin(AsyncWebServer &server) {
+    ws.onEvent([this](AsyncWebSocket *, AsyncWebSocketClient *, AwsEventType type,
+                      void *, uint8_t *, size_t) {
+        if (type == WS_EVT_CONNECT) resync.store(true);
+    });
+    server.addHandler(&ws);
+}
+
+void DisplayMirror::loop() {
+    if (millis() - lastCleanup >= 1000) {
+        lastCleanup = millis();
+        ws.cleanupClients();
+    }
+    if (ws.count() == 0) return;
+    if (millis() - lastSend < 1000 / MIRROR_MAX_FPS) return;
+
+    bool key = resync.exchange(false);
+    uint32_t count = display.getPresentedCount();
+    if (!key && count == lastCount) return;   // seit dem letzten Senden nichts gelatcht
+    lastCount = count;
+
+    const uint8_t *frame = display.getPresentedFrame();
+    uint8_t msg[1 + 4 + 32];
+    size_t len;
+
+    uint32_t mask = 0;
+    uint8_t changed = 0;
+    for (uint8_t i = 0; i < 32; ++i) {
+        if (frame[i] != lastSent[i]) {
+            mask |= 1UL << i;
+            changed++;
+        }
+    }
+    if (!key && changed == 0) return;
+
+    if (key || changed >= 27) {
+        // Delta wäre nicht kleiner als ein Keyframe
+        msg[0] = 'K';
+        memcpy(msg + 1, frame, 32);
+        len = 33;
+    } else {
+        msg[0] = 'D';
+        msg[1] = mask >> 24;
+        msg[2] = mask >> 16;
+        msg[3] = mask >> 8;
+        msg[4] = mask;
+        len = 5;
+        for (uint8_t i = 0; i < 32; ++i)
+            if (mask & (1UL << i)) msg[len++] = frame[i];
+    }
+    memcpy(lastSent, frame, 32);
+    lastSend = millis();
+
+    // Ein Puffer für alle Clients
+    ws.binaryAll(msg, len);
+    bytesSent += len * ws.count();
+}
@@ -1,4 +1,5 @@
 #include "game_of_life.h"
+#include "profiler.h"
 
 GameOfLife::GameOfLife(Display &display) : disp(display) {
     clear();
@@ -68,6 +69,7 @@ uint8_t GameOfLife::countNeighborsWrapped(int x, int y) const {
 }
 
 void GameOfLife::step() {
+    PROFILE_ZONE("GameOfLife::step");
     bool changed = false;
 
     // Nächsten Zustand berechnen
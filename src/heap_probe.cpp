@@ -0,0 +1,61 @@
+#include "heap_probe.h"
+
+#ifdef HEAP_PROBE
+
+#include <stddef.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+// Messender Task (nullptr = keine Messung); kein thread_local, weil malloc
+// schon vor dem Scheduler-Start aufgerufen wird
+static TaskHandle_t volatile probeTask = nullptr;
+static volatile bool paused = false;
+static volatile uint32_t allocations = 0;
+
+static inline void countAllocation() {
+    if (probeTask && !paused && xTaskGetCurrentTaskHandle() == probeTask) allocations++;
+}
+
+void heapProbeStart() {
+    allocations = 0;
+    paused = false;
+    probeTask = xTaskGetCurrentTaskHandle();
+}
+
+uint32_t heapProbeStop() {
+    probeTask = nullptr;
+    return allocations;
+}
+
+HeapProbePause::HeapProbePause() : wasPaused(paused) {
+    paused = true;
+}
+
+HeapProbePause::~HeapProbePause() {
+    paused = wasPaused;
+}
+
+// -Wl,--wrap=malloc leitet jeden malloc-Aufruf (auch aus String, new und
+// Bibliotheken) hierher um, __real_malloc ist das Original
+extern "C" {
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t n, size_t size);
+void *__real_realloc(void *ptr, size_t size);
+
+void *__wrap_malloc(size_t size) {
+    countAllocation();
+    return __real_malloc(size);
+}
+
+void *__wrap_calloc(size_t n, size_t size) {
+    countAllocation();
+    return __real_calloc(n, size);
+}
+
+void *__wrap_realloc(void *ptr, size_t size) {
+    countAllocation();
+    return __real_realloc(ptr, size);
+}
+}
+
+#endif
@@ -0,0 +1,124 @@
+#include "https_pool.h"
+#include "logger.h"
+
+HttpsPool httpsPool;
+
+void HttpsPool::begin() {
+    if (available) return;
+    available = xSemaphoreCreateCounting(HTTPS_MAX_TLS_CONTEXTS, HTTPS_MAX_TLS_CONTEXTS);
+    lock = xSemaphoreCreateMutex();
+    for (auto &s : slots) {
+        s.client.setInsecure();  // kein Zertifikat prüfen (wie bisher)
+        s.client.setTimeout(15);
+    }
+    LOG_INFO(HTTPS, "Pool bereit (%d TLS-Kontexte)", HTTPS_MAX_TLS_CONTEXTS);
+}
+
+bool HttpsPool::parseUrl(const String& url, char* host, size_t hostLen, uint16_t& port) {
+    if (!url.startsWith("https://")) return false;
+    int start = 8;
+    int end = start;
+    while (end < (int)url.length() && url[end] != '/' && url[end] != ':') ++end;
+    if (end == start || (size_t)(end - start) >= hostLen) return false;
+
+    memcpy(host, url.c_str() + start, end - start);
+    host[end - start] = '\0';
+    port = (end < (int)url.length() && url[end] == ':') ? (uint16_t)atoi(url.c_str() + end + 1) : 443;
+    return true;
+}
+
+WiFiClientSecure* HttpsPool::acquire(const String& url, uint32_t waitMs) {
+    char host[HTTPS_HOST_MAX_LEN];
+    uint16_t port;
+    if (!parseUrl(url, host, sizeof(host), port)) return nullptr;
+    return acquire(host, port, waitMs);
+}
+
+WiFiClientSecure* HttpsPool::acquire(const char* host, uint16_t port, uint32_t waitMs) {
+    begin();
+
+    // Obergrenze für gleichzeitige TLS-Kontexte
+    if (xSemaphoreTake(available, pdMS_TO_TICKS(waitMs)) != pdTRUE) {
+        LOG_WARN(HTTPS, "Kein TLS-Kontext frei für %s", host);
+        return nullptr;
+    }
+
+    // Slot wählen: offene Verbindung zum selben Host bevorzugen, sonst ältesten freien
+    xSemaphoreTake(lock, portMAX_DELAY);
+    Slot* chosen = nullptr;
+    for (auto &s : slots) {
+        if (s.inUse) continue;
+        if (s.port == port && strcmp(s.host, host) == 0) { chosen = &s; break; }
+        if (!chosen || s.lastUsed < chosen->lastUsed) chosen = &s;
+    }
+    chosen->inUse = true;
+    xSemaphoreGive(lock);
+
+    WiFiClientSecure &client = chosen->client;
+    bool sameHost = chosen->port == port && strcmp(chosen->host, host) == 0;
+
+    if (sameHost && client.connected()) {
+        reuses++;
+        LOG_DEBUG(HTTPS, "%s: Keep-Alive wiederverwendet (Heap frei %u)", host, ESP.getFreeHeap());
+        return &client;
+    }
+
+    // Neue Verbindung: alten Kontext zuerst freigeben, dann Handshake messen
+    client.stop();
+    strncpy(chosen->host, host, HTTPS_HOST_MAX_LEN - 1);
+    chosen->host[HTTPS_HOST_MAX_LEN - 1] = '\0';
+    chosen->port = port;
+
+    uint32_t heapBefore = ESP.getFreeHeap();
+    unsigned long t0 = millis();
+    bool ok = client.connect(host, port);
+    uint32_t ms = millis() - t0;
+    uint32_t heapAfter = ESP.getFreeHeap();
+
+    if (!ok) {
+        LOG_WARN(HTTPS, "%s: Verbindung fehlgeschlagen nach %u ms", host, ms);
+        release(&client, false);
+        return nullptr;
+    }
+
+    handshakes++;
+    lastHandshakeMs = ms;
+    if (ms > maxHandshakeMs) maxHandshakeMs = ms;
+    LOG_INFO(HTTPS, "%s: TLS-Handshake %u ms, TLS-Kontext %d B, Heap frei %u / min %u",
+             host, ms, (int)heapBefore - (int)heapAfter, heapAfter, ESP.getMinFreeHeap());
+    return &client;
+}
+
+void HttpsPool::release(WiFiClientSecure* client, bool keepAlive) {
+    if (!client) return;
+
+    xSemaphoreTake(lock, portMAX_DELAY);
+    for (auto &s : slots) {
+        if (&s.client != client || !s.inUse) continue;
+        if (!keepAlive || !client->connected()) {
+            client->stop();
+            s.host[0] = '\0';
+            s.port = 0;
+        }
+        s.lastUsed = millis();
+        s.inUse = false;
+        xSemaphoreGive(available);
+        break;
+    }
+    xSemaphoreGive(lock);
+}
+
+void HttpsPool::closeIdle() {
+    if (!lock || millis() - lastIdleCheck < 1000) return;
+    lastIdleCheck = millis();
+
+    xSemaphoreTake(lock, portMAX_DELAY);
+    for (auto &s : slots) {
+        if (s.inUse || s.host[0] == '\0') continue;
+        if (millis() - s.lastUsed < HTTPS_IDLE_TIMEOUT_MS && s.client.connected()) continue;
+        s.client.stop();
+        s.host[0] = '\0';
+        s.port = 0;
+    }
+    xSemaphoreGive(lock);
+}
@@ -0,0 +1,123 @@
+#include "json_writer.h"
+
+JsonWriter::JsonWriter(char* buffer, size_t capacity) : buf(buffer), cap(capacity) {
+    if (cap > 0) buf[0] = '\0';
+    else overflow = true;
+}
+
+void JsonWriter::raw(const char* s, size_t n) {
+    if (overflow) return;
+    if (len + n >= cap) {
+        overflow = true;
+        return;
+    }
+    memcpy(buf + len, s, n);
+    len += n;
+    buf[len] = '\0';
+}
+
+void JsonWriter::escaped(const char* s) {
+    static const char hex[] = "0123456789abcdef";
+    rawChar('"');
+    for (; s && *s; ++s) {
+        uint8_t c = (uint8_t)*s;
+        switch (c) {
+        case '"':  raw("\\\"", 2); break;
+        case '\\': raw("\\\\", 2); break;
+        case '\n': raw("\\n", 2); break;
+        case '\r': raw("\\r", 2); break;
+        case '\t': raw("\\t", 2); break;
+        default:
+            if (c < 0x20) {
+                char esc[6] = {'\\', 'u', '0', '0', hex[c >> 4], hex[c & 0x0F]};
+                raw(esc, sizeof(esc));
+            } else {
+                rawChar((char)c);   // UTF-8 unverändert übernehmen
+            }
+        }
+    }
+    rawChar('"');
+}
+
+// Komma + optional "key": vor jedem Element
+void JsonWriter::prefix(const char* key) {
+    if (depth > 0) {
+        uint8_t bit = 1 << (depth - 1);
+        if (hasItems & bit) rawChar(',');
+        hasItems |= bit;
+    }
+    if (key) {
+        escaped(key);
+        rawChar(':');
+    }
+}
+
+void JsonWriter::open(const char* key, char bracket) {
+    if (depth >= JSON_WRITER_MAX_DEPTH) {
+        overflow = true;
+        return;
+    }
+    prefix(key);
+    rawChar(bracket);
+    depth++;
+    hasItems &= ~(1 << (depth - 1));
+}
+
+void JsonWriter::close(char bracket) {
+    if (depth == 0) {
+        overflow = true;
+        return;
+    }
+    depth--;
+    rawChar(bracket);
+}
+
+JsonWriter& JsonWriter::beginObject(const char* key) { open(key, '{'); return *this; }
+JsonWriter& JsonWriter::endObject() { close('}'); return *this; }
+JsonWriter& JsonWriter::beginArray(const char* key) { open(key, '['); return *this; }
+JsonWriter& JsonWriter::endArray() { close(']'); return *this; }
+
+JsonWriter& JsonWriter::add(const char* key, const char* value) {
+    prefix(key);
+    if (value) escaped(value);
+    else raw("null");
+    return *this;
+}
+
+JsonWriter& JsonWriter::addSigned(const char* key, long value) {
+    char num[21];
+    prefix(key);
+    raw(num, snprintf(num, sizeof(num), "%ld", value));
+    return *this;
+}
+
+JsonWriter& JsonWriter::addUnsigned(const char* key, unsigned long value) {
+    char num[21];
+    prefix(key);
+    raw(num, snprintf(num, sizeof(num), "%lu", value));
+    return *this;
+}
+
+JsonWriter& JsonWriter::add(const char* key, float value, uint8_t decimals) {
+    prefix(key);
+    if (isnan(value) || isinf(value)) {
+        raw("null");   // JSON kennt kein NaN/Inf
+        return *this;
+    }
+    char num[24];
+    int n = snprintf(num, sizeof(num), "%.*f", decimals, value);
+    raw(num, min((size_t)max(n, 0), sizeof(num) - 1));
+    return *this;
+}
+
+JsonWriter& JsonWriter::addBool(const char* key, bool value) {
+    prefix(key);
+    raw(value ? "true" : "false");
+    return *this;
+}
+
+JsonWriter& JsonWriter::addNull(const char* key) {
+    prefix(key);
+    raw("null");
+    return *this;
+}
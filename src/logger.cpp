@@ -0,0 +1,226 @@
+#include "logger.h"
+#include "diagnostics.h"
+
+Logger logger;
+
+static_assert((LOG_QUEUE_SIZE & (LOG_QUEUE_SIZE - 1)) == 0, "LOG_QUEUE_SIZE muss eine Zweierpotenz sein");
+
+static const char *const MODULE_NAMES[] = {
+    "Main", "Display", "Web", "WiFi", "Time", "Weather", "OTA", "Settings", "HTTPS", "DDP", "History", "Game",
+};
+static const char *const LEVEL_NAMES[] = {"debug", "info", "warn", "error", "off"};
+
+Logger::Logger() {
+    static_assert(sizeof(MODULE_NAMES) / sizeof(MODULE_NAMES[0]) == (size_t)LogModule::COUNT, "MODULE_NAMES unvollständig");
+    for (uint32_t i = 0; i < LOG_QUEUE_SIZE; ++i) cells[i].seq.store(i, std::memory_order_relaxed);
+    setLevelAll(LOG_DEFAULT_LEVEL);
+}
+
+void Logger::begin() {
+    // Core 0, Priorität 1: konkurriert nicht mit dem Haupt-loop (Core 1)
+    if (xTaskCreatePinnedToCore(taskEntry, "LogTask", 4096, this, 1, &task, 0) != pdPASS) {
+        Serial.println("[Log] Task konnte nicht gestartet werden");
+    }
+}
+
+void Logger::taskEntry(void *arg) {
+    Logger *self = static_cast<Logger *>(arg);
+    diagnostics.watchCurrentTask();
+    for (;;) {
+        diagnostics.feed();
+        self->drain();
+        vTaskDelay(pdMS_TO_TICKS(20));
+    }
+}
+
+void Logger::setLevel(LogModule module, LogLevel level) {
+    if (module < LogModule::COUNT) levels[(uint8_t)module] = (uint8_t)level;
+}
+
+void Logger::setLevelAll(LogLevel level) {
+    for (uint8_t i = 0; i < (uint8_t)LogModule::COUNT; ++i) levels[i] = (uint8_t)level;
+}
+
+// ------------------------------------------------------
+// Erzeuger (beliebiger Task)
+// ------------------------------------------------------
+void Logger::addArg(LogRecord &r, float v) {
+    uint32_t bits;
+    memcpy(&bits, &v, sizeof(bits));
+    addRaw(r, bits);
+}
+
+void Logger::addArg(LogRecord &r, const char *s) {
+    if (!s) s = "(null)";
+    // Platz im Textbereich reservieren; passt nichts mehr, bleibt ein leerer String
+    size_t room = LOG_TEXT_LEN - r.textLen;
+    if (room == 0) return;
+    size_t n = strnlen(s, room - 1);
+    memcpy(r.text + r.textLen, s, n);
+    r.text[r.textLen + n] = '\0';
+    r.textLen += n + 1;
+}
+
+void Logger::push(const LogRecord &r) {
+    uint32_t pos = head.load(std::memory_order_relaxed);
+    for (;;) {
+        Cell &cell = cells[pos & (LOG_QUEUE_SIZE - 1)];
+        int32_t diff = (int32_t)(cell.seq.load(std::memory_order_acquire) - pos);
+        if (diff == 0) {
+            if (head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                cell.record = r;
+                cell.seq.store(pos + 1, std::memory_order_release);
+                return;
+            }
+        } else if (diff < 0) {
+            dropped.fetch_add(1, std::memory_order_relaxed);   // voll
+            return;
+        } else {
+            pos = head.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+// ------------------------------------------------------
+// Verbraucher (LogTask oder flush()); nur einer gleichzeitig
+// ------------------------------------------------------
+bool Logger::drain() {
+    if (draining.exchange(true, std::memory_order_acquire)) return false;
+
+    char line[LOG_LINE_LEN];
+    for (;;) {
+        Cell &cell = cells[tail & (LOG_QUEUE_SIZE - 1)];
+        if (cell.seq.load(std::memory_order_acquire) != tail + 1) break;
+        LogRecord r = cell.record;
+        cell.seq.store(tail + LOG_QUEUE_SIZE, std::memory_order_release);
+        tail++;
+
+        portENTER_CRITICAL(&historyMux);
+        r.seq = nextSeq++;
+        history[r.seq % LOG_HISTORY_SIZE] = r;
+        portEXIT_CRITICAL(&historyMux);
+
+        format(r, line, sizeof(line));
+        Serial.printf("%5lu.%03lu %c [%s] %s\n", (unsigned long)(r.ms / 1000), (unsigned long)(r.ms % 1000),
+                      "DIWE?"[min((uint8_t)r.level, (uint8_t)4)], moduleName(r.module), line);
+    }
+
+    draining.store(false, std::memory_order_release);
+    return true;
+}
+
+void Logger::flush() {
+    // Läuft der LogTask gerade, kurz auf ihn warten
+    for (uint8_t i = 0; i < 50 && !drain(); ++i) vTaskDelay(pdMS_TO_TICKS(2));
+    Serial.flush();
+}
+
+bool Logger::copyRecent(uint32_t since, LogRecord &out) const {
+    portENTER_CRITICAL(&historyMux);
+    uint32_t oldest = nextSeq > LOG_HISTORY_SIZE ? nextSeq - LOG_HISTORY_SIZE : 0;
+    if (since < oldest) since = oldest;
+    bool found = since < nextSeq;
+    if (found) out = history[since % LOG_HISTORY_SIZE];
+    portEXIT_CRITICAL(&historyMux);
+    return found;
+}
+
+// ------------------------------------------------------
+// Formatierung: Formatstring Stück für Stück mit den gespeicherten
+// Argumenten ausgeben (Längenmodifikatoren entfallen, alles 32 Bit)
+// ------------------------------------------------------
+size_t Logger::format(const LogRecord &r, char *out, size_t len) {
+    size_t pos = 0;
+    uint8_t arg = 0;
+    const char *text = r.text;
+    const char *textEnd = r.text + r.textLen;
+    auto room = [&]() { return pos < len ? len - pos : 0; };
+    auto advance = [&](int n) { if (n > 0) pos = min(pos + (size_t)n, len - 1); };
+
+    for (const char *p = r.fmt; *p && pos + 1 < len; ++p) {
+        if (*p != '%') {
+            out[pos++] = *p;
+            continue;
+        }
+        if (p[1] == '%') {
+            out[pos++] = '%';
+            ++p;
+            continue;
+        }
+
+        // Spezifikation ohne Längenmodifikator kopieren: %[flags][width][.prec]conv
+        char spec[16] = "%";
+        size_t s = 1;
+        const char *q = p + 1;
+        while (*q && strchr("-+ #0123456789.", *q) && s < sizeof(spec) - 2) spec[s++] = *q++;
+        while (*q && strchr("hlzjt", *q)) ++q;
+        char conv = *q;
+        if (!conv) break;
+        spec[s++] = conv;
+        spec[s] = '\0';
+        p = q;
+
+        if (conv == 's') {
+            const char *str = text < textEnd ? text : "";
+            if (text < textEnd) text += strlen(text) + 1;
+            advance(snprintf(out + pos, room(), spec, str));
+            continue;
+        }
+        if (arg >= r.argc) {
+            advance(snprintf(out + pos, room(), "?"));
+            continue;
+        }
+        uint32_t raw = r.args[arg++];
+        switch (conv) {
+        case 'd':
+        case 'i':
+            advance(snprintf(out + pos, room(), spec, (int)raw));
+            break;
+        case 'f': case 'F': case 'e': case 'E': case 'g': case 'G': {
+            float f;
+            memcpy(&f, &raw, sizeof(f));
+            advance(snprintf(out + pos, room(), spec, (double)f));
+            break;
+        }
+        case 'p':
+            advance(snprintf(out + pos, room(), spec, (void *)(uintptr_t)raw));
+            break;
+        default:   // u, x, X, o, c
+            advance(snprintf(out + pos, room(), spec, (unsigned)raw));
+            break;
+        }
+    }
+
+    // Zeilenumbruch am Ende kommt vom Logger selbst
+    while (pos > 0 && (out[pos - 1] == '\n' || out[pos - 1] == '\r')) --pos;
+    out[pos] = '\0';
+    return pos;
+}
+
+const char *Logger::moduleName(LogModule module) {
+    return module < LogModule::COUNT ? MODULE_NAMES[(uint8_t)module] : "?";
+}
+
+const char *Logger::levelName(LogLevel level) {
+    return level <= LogLevel::Off ? LEVEL_NAMES[(uint8_t)level] : "?";
+}
+
+bool Logger::parseModule(const char *name, LogModule &module) {
+    for (uint8_t i = 0; i < (uint8_t)LogModule::COUNT; ++i) {
+        if (strcasecmp(name, MODULE_NAMES[i]) == 0) {
+            module = (LogModule)i;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool Logger::parseLevel(const char *name, LogLevel &level) {
+    for (uint8_t i = 0; i <= (uint8_t)LogLevel::Off; ++i) {
+        if (strcasecmp(name, LEVEL_NAMES[i]) == 0) {
+            level = (LogLevel)i;
+            return true;
+        }
+    }
+    return false;
+}
@@ -7,13 +7,17 @@
 #include "web_server_manager.h"
 #include "weather_manager.h"
 #include "game_of_life.h"
-#include <HTTPClient.h>
-#include <HTTPUpdate.h>
-#include <WiFiClient.h>
-#include <Update.h>
 #include "version.h"
 #include "pong.h"
 #include "matrix_rain.h"
+#include "https_pool.h"
+#include "pixel_receiver.h"
+#include "ota_service.h"
+#include "metrics.h"
+#include "metric_history.h"
+#include "logger.h"
+#include "profiler.h"
+#include "diagnostics.h"
 #include <math.h>
 
 // ======================================================
@@ -24,7 +28,6 @@ Pong pong;
 MatrixRain matrixRain(display);
 
 int previousMode = -1;
-unsigned long lastDisplayUpdate = 0;
 unsigned long lastButtonCheck = 0;
 unsigned long lastWeatherUpdate = 0;
 
@@ -50,9 +53,7 @@ void drawSecondsView(uint8_t s);
 void drawDateView(uint8_t day, uint8_t month);
 void updateBrightness();
 void checkWiFi();
-void updateWeather();
-void performOTAUpdate();
-void showOTAError();
+bool drawOTAStatus();
 
 // ======================================================
 // 🧩 SETUP
@@ -61,9 +62,13 @@ void setup()
 {
     Serial.begin(115200);
     delay(100);
+    logger.begin();
     Serial.println("\n=== OBEGRÄNSAD-X ESP32 " + String(CURRENT_VERSION) + " ===");
+    diagnostics.begin();
 
     settingsManager.begin();
+    otaService.begin();
+    metricHistory.begin();
     display.begin();
     display.setBrightness(settingsManager.getBrightness());
 
@@ -73,29 +78,46 @@ void setup()
     display.drawText2x2("WIFI");
     display.update();
 
-    if (!wifiConnection.begin())
+    if (wifiConnection.begin())
     {
-        Serial.println("[WiFi] Verbindung fehlgeschlagen! Neustart in 5s...");
+        display.animateCheckmark();
+    }
+    else if (otaService.isPendingVerify())
+    {
+        // A restart now would roll back the fresh image → keep running offline,
+        // checkWiFi() shows "WIFI" until the connection comes back
+        LOG_ERROR(WiFi, "Verbindung fehlgeschlagen, neues Image läuft ohne WLAN weiter");
+    }
+    else
+    {
+        LOG_ERROR(WiFi, "Verbindung fehlgeschlagen! Neustart in 5s...");
         delay(5000);
+        logger.flush();
         ESP.restart();
     }
 
-    display.animateCheckmark();
-
     timeManager.begin();
+    httpsPool.begin();
     // Initialisiere Wetter mit gespeicherter Stadt
     weatherManager.begin(settingsManager.getCity());
     webServer.begin();
+    pixelReceiver.begin();
 
-    Serial.println("[System] Bereit unter: http://" + wifiConnection.getIP());
+    LOG_INFO(Main, "Bereit unter: http://%s", wifiConnection.getIP());
     delay(300);
 
     // Restore previous mode
-    Serial.printf("[Settings] Gespeicherter Modus: %d\n", settingsManager.getDisplayMode());
+    LOG_INFO(Settings, "Gespeicherter Modus: %d", settingsManager.getDisplayMode());
     updateDisplay();
 
     // Initialize Game of Life
     life.begin(250);
+
+    // Redraw aligned to the wall-clock second
+    timeManager.startSecondTick(xTaskGetCurrentTaskHandle());
+
+    // Task watchdog from here on (the WiFi portal in setup may legitimately block)
+    diagnostics.watchCurrentTask();
 }
 
 // ======================================================
@@ -103,51 +125,110 @@ void setup()
 // ======================================================
 void loop()
 {
-    webServer.handleClient();
+    PROFILE_ZONE("loop");
+    uint32_t loopStart = micros();
+    diagnostics.feed();
+
+    // Deferred web actions (restart, OTA, city change); requests themselves run on the AsyncTCP task
+    diagnostics.stage(DiagStage::Web);
+    webServer.loop();
 
     // Check button every 50ms
+    diagnostics.stage(DiagStage::Button);
     if (millis() - lastButtonCheck >= 50)
     {
         lastButtonCheck = millis();
         handleButton();
     }
 
-    // Update display every second
-    if (millis() - lastDisplayUpdate >= 1000)
+    // Confirm a freshly flashed image / restart after a finished update
+    diagnostics.stage(DiagStage::Ota);
+    otaService.loop();
+
+    // UDP pixel stream (DDP) takes over the panel while frames arrive;
+    // OTA progress has priority over both
+    diagnostics.stage(DiagStage::Panel);
+    static bool panelOverride = false;
+    bool wasOverridden = panelOverride;
+    panelOverride = drawOTAStatus() || pixelReceiver.update();
+    metrics.setOverride(panelOverride);
+    if (wasOverridden && !panelOverride)
     {
-        lastDisplayUpdate = millis();
-        timeManager.update();
+        // Stream timed out / OTA finished → restore the configured mode
         updateDisplay();
     }
 
+    // Update display on every wall-clock second (esp_timer tick)
+    diagnostics.stage(DiagStage::Display);
+    if (timeManager.takeSecondTick())
+    {
+        timeManager.update();
+        if (!panelOverride)
+        {
+            updateDisplay();
+            timeManager.markFrameLatched();
+        }
+        else
+        {
+            metrics.countSkippedFrame();
+        }
+    }
+
     // Update weather every 10 minutes
+    diagnostics.stage(DiagStage::Weather);
     if (millis() - lastWeatherUpdate > 10UL * 60UL * 1000UL)
     {
         lastWeatherUpdate = millis();
-        updateWeather();
+        weatherManager.updateAsync();
     }
 
     // Check WiFi connection
+    diagnostics.stage(DiagStage::WiFi);
     checkWiFi();
 
+    // Release idle keep-alive TLS connections
+    diagnostics.stage(DiagStage::Https);
+    httpsPool.closeIdle();
+
     // Handle brightness changes
+    diagnostics.stage(DiagStage::Brightness);
     updateBrightness();
+    display.handleBrightness();
 
-    // Run Game of Life animation
-    if (life.isRunning())
-    {
-        life.update();
-    }
-    else if (pong.isRunning())
-    {
-        pong.update();
-    }
-    else if (matrixRain.isRunning())
+    // Persist settings changes after they settle (debounced flash write)
+    diagnostics.stage(DiagStage::Settings);
+    settingsManager.loop();
+
+    // Run animations (paused while the pixel stream or OTA owns the panel)
+    diagnostics.stage(DiagStage::Animation);
+    if (!panelOverride)
     {
-        matrixRain.update();
+        if (life.isRunning())
+        {
+            life.update();
+        }
+        else if (pong.isRunning())
+        {
+            pong.update();
+        }
+        else if (matrixRain.isRunning())
+        {
+            matrixRain.update();
+        }
     }
 
-    delay(10);
+    // 1-Hz samples for /api/history, heap watch for the flight recorder
+    diagnostics.stage(DiagStage::History);
+    metricHistory.loop();
+    diagnostics.loop();
+
+    metrics.observeLoop(micros() - loopStart);
+
+    // Sleep up to 10ms, but wake immediately on the second tick
+    // (own zone, so the wait does not show up as loop self time)
+    PROFILE_ZONE("idle");
+    diagnostics.stage(DiagStage::Idle);
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(10));
 }
 
 // ======================================================
@@ -166,15 +247,15 @@ void handleButton()
     // Knopf wird gehalten
     if (currentState == LOW && (millis() - lastPress) >= 5000)
     {
-        Serial.println("[Main] 5s langer Druck erkannt → OTA-Update starten");
-        performOTAUpdate();
+        LOG_INFO(Main, "5s langer Druck erkannt → OTA-Update starten");
+        otaService.start();
         lastPress = millis() + 10000; // debounce nach OTA
     }
 
     // Kurzer Druck: Modus wechseln
     if (currentState == HIGH && lastButtonState == LOW && (millis() - lastPress) < 5000)
     {
-        Serial.println("[Main] Kurzer Druck – Modus wechseln");
+        LOG_INFO(Main, "Kurzer Druck – Modus wechseln");
         uint8_t newMode = (settingsManager.getDisplayMode() + 1) % (DISPLAYMODES + 1);
         settingsManager.setDisplayMode(newMode);
         updateDisplay();
@@ -188,6 +269,7 @@ void handleButton()
 // ======================================================
 void updateDisplay()
 {
+    PROFILE_FUNCTION();
     uint8_t mode = settingsManager.getDisplayMode();
     uint8_t h = timeManager.getHour();
     uint8_t m = timeManager.getMinute();
@@ -198,7 +280,7 @@ void updateDisplay()
         if (previousMode == 5 && life.isRunning())
         {
             life.stop();
-            Serial.println("[GameOfLife] Animation gestoppt");
+            LOG_INFO(Game, "Game of Life gestoppt");
         }
         else if (previousMode == 6 && pong.isRunning())
         {
@@ -209,16 +291,18 @@ void updateDisplay()
             matrixRain.stop();
         }
         previousMode = mode;
+        metrics.setMode(mode);
+        diagnostics.record(DiagEvent::Mode, mode);
     }
 
     // Weather toggle every 5s in manual mode
-    if (mode == 3 && millis() - lastWeatherToggle > 5000)
+    if ((mode == 3 || mode == 9) && millis() - lastWeatherToggle > 5000)
     {
         weatherToggle = !weatherToggle;
         lastWeatherToggle = millis();
     }
 
-    Serial.printf("[Display] Mode %d | %02d:%02d:%02d\n", mode, h, m, s);
+    LOG_DEBUG(Display, "Mode %d | %02d:%02d:%02d", mode, h, m, s);
 
     switch (mode)
     {
@@ -236,7 +320,7 @@ void updateDisplay()
         if (weatherToggle)
         {
             display.drawWeather(weatherManager.getTemperature(),
-                                weatherManager.getCondition() + "_icon",
+                                weatherManager.getCondition(),
                                 WeatherMode::MODE_ICON);
         }
         else
@@ -263,7 +347,7 @@ void updateDisplay()
             life.spawnGlider(3, 3);
             life.randomize(30);
             life.start();
-            Serial.println("[GameOfLife] Animation gestartet");
+            LOG_INFO(Game, "Game of Life gestartet");
         }
         break;
 
@@ -324,7 +408,18 @@ void updateDisplay()
             matrixRain.start();
         break;
 
-    case 9: // ⚫ Display aus (immer letzter Modus)
+    case 9: // 📈 Vorhersage: Temperatur-Sparkline / Regenbalken (48h)
+    {
+        // Kopie: der WeatherUpdateTask kann jederzeit neu veröffentlichen
+        uint16_t columns[FORECAST_SLOTS];
+        if (!weatherManager.copyForecastColumns(columns, weatherToggle))
+            display.drawText2x2("NA");
+        else
+            display.drawColumns(columns);
+        break;
+    }
+
+    case 10: // ⚫ Display aus (immer letzter Modus)
     default:
         display.clear();
         display.update();
@@ -360,17 +455,6 @@ void drawDateView(uint8_t day, uint8_t month)
     display.update();
 }
 
-// ======================================================
-// 🌤️ WEATHER UPDATE (Async Task)
-// ======================================================
-void updateWeather()
-{
-    xTaskCreatePinnedToCore([](void *)
-                            {
-        weatherManager.update(true);
-        vTaskDelete(NULL); }, "WeatherUpdateTask", 8192, NULL, 1, NULL, 1);
-}
-
 // ======================================================
 // 📡 WIFI & BRIGHTNESS HELPERS
 // ======================================================
@@ -378,6 +462,7 @@ void checkWiFi()
 {
     if (!wifiConnection.isConnected())
     {
+        diagnostics.record(DiagEvent::WiFiLost);
         display.clear();
         display.drawText2x2("WIFI");
         display.update();
@@ -387,146 +472,90 @@ void checkWiFi()
 
 void updateBrightness()
 {
+    static uint32_t lastVersion = UINT32_MAX;
     static uint8_t lastBrightness = 255;
+
+    // Only look at settings when a new snapshot was published
+    uint32_t version = settingsManager.getVersion();
+    if (version == lastVersion)
+        return;
+    lastVersion = version;
+
     uint8_t current = settingsManager.getBrightness();
 
     if (current != lastBrightness)
     {
-        display.setBrightness(current);
+        // Smooth transition in the LEDC fade unit (no CPU time)
+        display.fadeBrightness(current, 250);
         lastBrightness = current;
-        Serial.printf("[Display] Neue Helligkeit übernommen: %d\n", current);
+        LOG_INFO(Display, "Neue Helligkeit übernommen: %d", current);
     }
 }
 
 // ======================================================
-// 🔄 OTA UPDATE HANDLER
+// 🔄 OTA STATUS (download runs in the OtaService task)
 // ======================================================
-void performOTAUpdate()
+// Returns true while the OTA status owns the panel
+bool drawOTAStatus()
 {
-    Serial.println("[OTA] Button OTA gestartet");
+    static int lastPercent = -1;
+    static OtaState lastState = OtaState::Idle;
 
-    display.clear();
-    display.update();
+    OtaStatus status = otaService.getStatus();
+    bool changed = status.state != lastState;
+    lastState = status.state;
 
-    WiFiClientSecure client;
-    client.setInsecure();
-
-    HTTPClient http;
-    http.setFollowRedirects(HTTPC_STRICT_FOLLOW_REDIRECTS);
-
-    if (!http.begin(client, OTA_FIRMWARE_URL))
-    {
-        showOTAError();
-        return;
-    }
-
-    int code = http.GET();
-    if (code != HTTP_CODE_OK)
+    switch (status.state)
     {
-        Serial.printf("[OTA] HTTP Fehler %d\n", code);
-        http.end();
-        showOTAError();
-        return;
-    }
-
-    int total = http.getSize();
-    Serial.printf("[OTA] Firmwaregröße: %d Bytes\n", total);
+    case OtaState::Checking:
+        if (changed)
+            display.drawText2x2("UPDT");
+        return true;
 
-    if (total <= 0)
+    case OtaState::Downloading:
+    case OtaState::Verifying:
     {
-        Serial.println("[OTA] Ungültige Firmwaregröße");
-        http.end();
-        showOTAError();
-        return;
-    }
-
-    int lastDisplayedProgress = -1;
+        int percent = otaService.getPercent();
+        if (percent == lastPercent && !changed)
+            return true;
+        lastPercent = percent;
 
-    display.clear();
-    display.drawDigit(0, 7, 4);
-    display.update();
-
-    if (!Update.begin(total))
-    {
-        Serial.printf("[OTA] Update.begin fehlgeschlagen: %s\n", Update.errorString());
-        http.end();
-        showOTAError();
-        return;
+        display.clear();
+        if (percent >= 100)
+        {
+            display.drawDigit(1, 1, 4);
+            display.drawDigit(0, 6, 4);
+            display.drawDigit(0, 11, 4);
+        }
+        else if (percent >= 10)
+        {
+            display.drawDigit(percent / 10, 3, 4);
+            display.drawDigit(percent % 10, 9, 4);
+        }
+        else
+        {
+            display.drawDigit(percent, 7, 4);
+        }
+        display.update();
+        return true;
     }
 
-    Update.onProgress([total, &lastDisplayedProgress](size_t progress, size_t)
-                      {
-        int percent = (progress * 100) / total;
-        
-        int progressStep = percent / 10;
-        if (progressStep != lastDisplayedProgress) {
-            lastDisplayedProgress = progressStep;
-            Serial.printf("[OTA] Fortschritt: %d%%\n", percent);
-            
-            display.clear();
-            
-            // Draw percent digits using available drawDigit() function
-            // Position: centered on 16x16 display
-            if (percent >= 100) {
-                // "100" - three digits
-                display.drawDigit(1, 1, 4);   // "1" at x=1
-                display.drawDigit(0, 6, 4);   // "0" at x=6
-                display.drawDigit(0, 11, 4);  // "0" at x=11
-            } else if (percent >= 10) {
-                // "10-99" - two digits
-                display.drawDigit(percent / 10, 3, 4);      // tens digit
-                display.drawDigit(percent % 10, 9, 4);      // ones digit
-            } else {
-                // "0-9" - one digit, centered
-                display.drawDigit(percent, 7, 4);
-            }
-            
-            display.update();
-        } });
-
-    WiFiClient *stream = http.getStreamPtr();
-
-    size_t written = Update.writeStream(*stream);
-
-    display.clear();
-    display.drawDigit(1, 1, 4);
-    display.drawDigit(0, 6, 4);
-    display.drawDigit(0, 11, 4);
-    display.update();
-
-    Serial.printf("[OTA] Geschrieben: %d / %d Bytes\n", written, total);
+    case OtaState::Success:
+        if (changed)
+            display.animateCheckmark();
+        return true;
 
-    if (written != total)
-    {
-        Serial.printf("[OTA] Unvollständiger Download: %d von %d Bytes\n", written, total);
-        Update.abort();
-        http.end();
-        showOTAError();
-        return;
-    }
+    case OtaState::UpToDate:
+    case OtaState::Failed:
+        // Result stays visible for 1.5s, then the configured mode returns
+        if (millis() - status.finishedAt >= 1500)
+            return false;
+        if (changed)
+            display.drawText2x2(status.state == OtaState::UpToDate ? "OK" : "ERR");
+        return true;
 
-    if (!Update.end(true))
-    {
-        Serial.printf("[OTA] Update.end fehlgeschlagen: %s\n", Update.errorString());
-        http.end();
-        showOTAError();
-        return;
+    default:
+        lastPercent = -1;
+        return false;
     }
-
-    http.end();
-
-    Serial.printf("[OTA] Update abgeschlossen (%d Bytes)\n", written);
-    display.clear();
-    display.animateCheckmark();
-    display.update();
-    delay(1500);
-    ESP.restart();
 }
-
-void showOTAError()
-{
-    display.clear();
-    display.drawText2x2("ERR");
-    display.update();
-    delay(1500);
-}
\ No newline at end of file
@@ -1,5 +1,5 @@
 #include "matrix_rain.h"
-#include "settings_manager.h"
+#include "profiler.h"
 
 MatrixRain::MatrixRain(Display &display) : disp(display) { resetColumns(); }
 
@@ -37,6 +37,7 @@ void MatrixRain::stop() {
 
 void MatrixRain::update() {
     if (!running) return;
+    PROFILE_ZONE("MatrixRain::update");
 
     unsigned long now = millis();
 
@@ -66,7 +67,6 @@ void MatrixRain::update() {
 
     disp.clear();
 
-    uint8_t globalBrightness = settingsManager.getBrightness();
     // Head = full brightness via display.setPixel
     // Trail = stronger dimming via PWM phase masking
 
@@ -93,7 +93,5 @@ void MatrixRain::update() {
         }
     }
 
-    // ensure global brightness applied
-    disp.setBrightness(globalBrightness);
     disp.update();
 }
@@ -0,0 +1,258 @@
+#include "metric_history.h"
+#include "metrics.h"
+#include "wifi_manager.h"
+#include "json_writer.h"
+#include "logger.h"
+#include <Preferences.h>
+#include <esp_heap_caps.h>
+#include <time.h>
+
+MetricHistory metricHistory;
+
+#define HISTORY_NVS_NAMESPACE "history"
+#define HISTORY_NVS_VERSION 2   // 2: HISTORY_NO_DATA statt 0 für leere Intervalle
+
+// Kodierung als uint16: raw = (Wert - offset) / scale,
+// HISTORY_NO_DATA = keine Stichprobe im Intervall (JSON: null)
+struct SeriesInfo {
+    const char *name;
+    uint16_t scale;
+    int16_t offset;
+};
+static const SeriesInfo SERIES[HISTORY_SERIES] = {
+    {"heap", 16, 0},        // Bytes, bis 1 MiB
+    {"largest", 16, 0},     // Bytes
+    {"loop", 10, 0},        // µs, bis 655 ms
+    {"rssi", 1, -128},      // dBm
+    {"frame", 1, 0},        // µs
+};
+
+static uint16_t encode(HistorySeries series, int32_t value) {
+    const SeriesInfo &info = SERIES[(uint8_t)series];
+    int32_t raw = (value - info.offset) / info.scale;
+    return (uint16_t)constrain(raw, 0, HISTORY_NO_DATA - 1);
+}
+
+static int32_t decode(uint8_t series, uint16_t raw) {
+    return (int32_t)raw * SERIES[series].scale + SERIES[series].offset;
+}
+
+// Unix-Zeit nur, wenn die Uhr schon synchronisiert ist
+static uint32_t currentTime() {
+    time_t now = time(nullptr);
+    return now > 1600000000 ? (uint32_t)now : 0;
+}
+
+// Stunden- und Tagesstufe für NVS (statisch, nicht auf dem Loop-Stack)
+struct PersistedHistory {
+    uint8_t version;
+    uint8_t series;
+    uint8_t hourHead, hourCount;
+    uint8_t dayHead, dayCount;
+    HistoryPoint hour[HISTORY_HOUR_POINTS];
+    HistoryPoint day[HISTORY_DAY_POINTS];
+};
+static PersistedHistory persisted;
+
+void MetricHistory::begin() {
+    for (auto &a : acc) reset(a);
+    lastSample = millis();
+
+    Preferences prefs;
+    if (!prefs.begin(HISTORY_NVS_NAMESPACE, true)) return;   // noch nie gesichert
+    size_t len = prefs.getBytesLength("data");
+    if (len == sizeof(persisted) && prefs.getBytes("data", &persisted, len) == len &&
+        persisted.version == HISTORY_NVS_VERSION && persisted.series == HISTORY_SERIES &&
+        persisted.hourCount <= HISTORY_HOUR_POINTS && persisted.dayCount <= HISTORY_DAY_POINTS) {
+        Ring &hour = rings[(uint8_t)HistoryTier::Hour];
+        Ring &day = rings[(uint8_t)HistoryTier::Day];
+        memcpy(hourPoints, persisted.hour, sizeof(hourPoints));
+        memcpy(dayPoints, persisted.day, sizeof(dayPoints));
+        hour.head = persisted.hourHead % HISTORY_HOUR_POINTS;
+        hour.count = persisted.hourCount;
+        day.head = persisted.dayHead % HISTORY_DAY_POINTS;
+        day.count = persisted.dayCount;
+        LOG_INFO(History, "%u Stunden- und %u Tagespunkte geladen", hour.count, day.count);
+    }
+    prefs.end();
+}
+
+void MetricHistory::loop() {
+    if (millis() - lastSample < 1000) return;
+    lastSample = millis();
+    sample();
+}
+
+// ------------------------------------------------------
+// Verdichtung (Haupt-Task)
+// ------------------------------------------------------
+void MetricHistory::reset(Accumulator &a) {
+    for (uint8_t i = 0; i < HISTORY_SERIES; ++i) {
+        a.min[i] = UINT32_MAX;
+        a.max[i] = 0;
+        a.sum[i] = 0;
+        a.n[i] = 0;
+    }
+    a.samples = 0;
+}
+
+void MetricHistory::accumulate(Accumulator &a, uint8_t series, uint32_t lo, uint32_t avg, uint32_t hi) {
+    if (lo < a.min[series]) a.min[series] = lo;
+    if (hi > a.max[series]) a.max[series] = hi;
+    a.sum[series] += avg;
+    a.n[series]++;
+}
+
+HistoryPoint MetricHistory::finish(Accumulator &a) const {
+    HistoryPoint p;
+    p.time = currentTime();
+    for (uint8_t i = 0; i < HISTORY_SERIES; ++i) {
+        bool any = a.n[i] > 0;
+        p.min[i] = any ? a.min[i] : HISTORY_NO_DATA;
+        p.avg[i] = any ? a.sum[i] / a.n[i] : HISTORY_NO_DATA;
+        p.max[i] = any ? a.max[i] : HISTORY_NO_DATA;
+    }
+    return p;
+}
+
+void MetricHistory::sample() {
+    MetricsWindow w = metrics.takeWindow();
+    Accumulator &minute = acc[(uint8_t)HistoryTier::Minute];
+
+    auto addValue = [&minute](HistorySeries s, int32_t v) {
+        uint16_t raw = encode(s, v);
+        accumulate(minute, (uint8_t)s, raw, raw, raw);
+    };
+    addValue(HistorySeries::HeapFree, ESP.getFreeHeap());
+    addValue(HistorySeries::HeapLargest, heap_caps_get_largest_free_block(MALLOC_CAP_8BIT));
+    if (wifiConnection.isConnected()) addValue(HistorySeries::Rssi, wifiConnection.getRSSI());
+    // Loop/Frame: Sekundenmittel als Min/Mittel, Sekundenmaximum als Max
+    accumulate(minute, (uint8_t)HistorySeries::LoopUs, encode(HistorySeries::LoopUs, w.loopAvgUs),
+               encode(HistorySeries::LoopUs, w.loopAvgUs), encode(HistorySeries::LoopUs, w.loopMaxUs));
+    if (w.pushCount > 0) {
+        accumulate(minute, (uint8_t)HistorySeries::FrameUs, encode(HistorySeries::FrameUs, w.pushAvgUs),
+                   encode(HistorySeries::FrameUs, w.pushAvgUs), encode(HistorySeries::FrameUs, w.pushMaxUs));
+    }
+
+    // Minute → Stunde → Tag
+    static const uint8_t PER_NEXT[] = {60, 60, 24};
+    for (uint8_t t = 0; t < (uint8_t)HistoryTier::COUNT; ++t) {
+        Accumulator &a = acc[t];
+        if (++a.samples < PER_NEXT[t]) break;
+
+        HistoryPoint point = finish(a);
+        addPoint((HistoryTier)t, point);
+        if (t + 1 < (uint8_t)HistoryTier::COUNT) {
+            for (uint8_t i = 0; i < HISTORY_SERIES; ++i) {
+                if (point.avg[i] != HISTORY_NO_DATA) accumulate(acc[t + 1], i, point.min[i], point.avg[i], point.max[i]);
+            }
+        }
+        reset(a);
+
+        if ((HistoryTier)t == HistoryTier::Hour && HISTORY_PERSIST_HOURS > 0 &&
+            ++hoursSincePersist >= HISTORY_PERSIST_HOURS) {
+            persist();
+        }
+    }
+}
+
+void MetricHistory::addPoint(HistoryTier tier, const HistoryPoint &point) {
+    Ring &r = rings[(uint8_t)tier];
+    portENTER_CRITICAL(&mux);
+    r.points[r.head] = point;
+    r.head = (r.head + 1) % r.capacity;
+    if (r.count < r.capacity) r.count++;
+    portEXIT_CRITICAL(&mux);
+}
+
+// ------------------------------------------------------
+// NVS-Sicherung (nur Stunde/Tag, höchstens alle HISTORY_PERSIST_HOURS)
+// ------------------------------------------------------
+void MetricHistory::persist() {
+    hoursSincePersist = 0;
+    const Ring &hour = rings[(uint8_t)HistoryTier::Hour];
+    const Ring &day = rings[(uint8_t)HistoryTier::Day];
+
+    persisted.version = HISTORY_NVS_VERSION;
+    persisted.series = HISTORY_SERIES;
+    persisted.hourHead = hour.head;
+    persisted.hourCount = hour.count;
+    persisted.dayHead = day.head;
+    persisted.dayCount = day.count;
+    memcpy(persisted.hour, hourPoints, sizeof(hourPoints));
+    memcpy(persisted.day, dayPoints, sizeof(dayPoints));
+
+    Preferences prefs;
+    if (!prefs.begin(HISTORY_NVS_NAMESPACE, false)) return;
+    size_t written = prefs.putBytes("data", &persisted, sizeof(persisted));
+    prefs.end();
+    LOG_INFO(History, "%u Bytes in NVS gesichert", written);
+}
+
+void MetricHistory::flush() {
+    if (HISTORY_PERSIST_HOURS > 0 && rings[(uint8_t)HistoryTier::Hour].count > 0) persist();
+}
+
+// ------------------------------------------------------
+// JSON (AsyncTCP-Task)
+// {"tier":str,"interval":u,"series":[str...],
+//  "points":[[time,min0,avg0,max0,min1,...],...]}  (älteste zuerst,
+//  null statt min/avg/max, wenn die Reihe im Intervall keine Stichprobe hatte)
+// ------------------------------------------------------
+size_t MetricHistory::serialize(HistoryTier tier, char *out, size_t len) const {
+    const Ring &r = rings[(uint8_t)tier];
+    JsonWriter json(out, len);
+    json.beginObject()
+        .add("tier", tierName(tier))
+        .add("interval", r.intervalS);
+    json.beginArray("series");
+    for (const SeriesInfo &s : SERIES) json.add(nullptr, s.name);
+    json.endArray();
+
+    portENTER_CRITICAL(&mux);
+    uint8_t count = r.count;
+    uint8_t first = (r.head + r.capacity - count) % r.capacity;
+    portEXIT_CRITICAL(&mux);
+
+    json.beginArray("points");
+    for (uint8_t i = 0; i < count; ++i) {
+        // Punkt einzeln kopieren: der Haupt-Task schreibt höchstens einmal pro Minute
+        portENTER_CRITICAL(&mux);
+        HistoryPoint p = r.points[(first + i) % r.capacity];
+        portEXIT_CRITICAL(&mux);
+
+        json.beginArray().add(nullptr, p.time);
+        for (uint8_t s = 0; s < HISTORY_SERIES; ++s) {
+            if (p.avg[s] == HISTORY_NO_DATA) {
+                json.addNull(nullptr).addNull(nullptr).addNull(nullptr);
+                continue;
+            }
+            json.add(nullptr, decode(s, p.min[s]))
+                .add(nullptr, decode(s, p.avg[s]))
+                .add(nullptr, decode(s, p.max[s]));
+        }
+        json.endArray();
+    }
+    json.endArray();
+    json.endObject();
+    return json.ok() ? json.length() : 0;
+}
+
+const char *MetricHistory::tierName(HistoryTier tier) {
+    switch (tier) {
+    case HistoryTier::Minute: return "minute";
+    case HistoryTier::Hour: return "hour";
+    case HistoryTier::Day: return "day";
+    default: return "unknown";
+    }
+}
+
+bool MetricHistory::parseTier(const char *name, HistoryTier &tier) {
+    for (uint8_t t = 0; t < (uint8_t)HistoryTier::COUNT; ++t) {
+        if (strcmp(name, tierName((HistoryTier)t)) == 0) {
+            tier = (HistoryTier)t;
+            return true;
+        }
+    }
+    return false;
+}
@@ -0,0 +1,302 @@
+#include "metrics.h"
+#include "power_governor.h"
+#include "https_pool.h"
+#include <esp_heap_caps.h>
+#include <freertos/task.h>
+
+Metrics metrics;
+
+// Obergrenzen der Histogramm-Buckets
+static const uint32_t LOOP_BOUNDS_US[] = {100, 250, 500, 1000, 2500, 5000, 10000, 25000, 50000, 100000};
+static const uint32_t PUSH_BOUNDS_US[] = {100, 200, 300, 500, 750, 1000, 2000, 5000};
+static const uint32_t HTTP_BOUNDS_US[] = {250, 500, 1000, 2500, 5000, 10000, 25000, 50000, 100000};
+static const uint32_t FETCH_BOUNDS_MS[] = {250, 500, 1000, 2000, 5000, 10000, 20000, 60000, 120000};
+
+#define COUNT_OF(a) (sizeof(a) / sizeof((a)[0]))
+
+static const char *const ROUTE_LABELS[] = {
+    "path=\"/\",method=\"GET\"",
+    "path=\"/api/settings\",method=\"GET\"",
+    "path=\"/api/settings\",method=\"POST\"",
+    "path=\"/api/status\",method=\"GET\"",
+    "path=\"/api/restart\",method=\"POST\"",
+    "path=\"/api/reset\",method=\"POST\"",
+    "path=\"/api/update\",method=\"POST\"",
+    "path=\"/api/update/status\",method=\"GET\"",
+    "path=\"/metrics\",method=\"GET\"",
+    "path=\"/api/history\",method=\"GET\"",
+    "path=\"/api/logs\",method=\"GET\"",
+    "path=\"/api/logs/level\",method=\"POST\"",
+    "path=\"/api/profile\",method=\"GET\"",
+    "path=\"/api/diagnostics\",method=\"GET\"",
+};
+
+static const char *const FETCH_LABELS[] = {
+    "source=\"weather\"",
+    "source=\"ota_check\"",
+    "source=\"ota_image\"",
+};
+
+// Dauerhaft laufende Tasks, deren Stack-Reserve beim Abruf gelesen wird
+static const char *const PERSISTENT_TASKS[] = {"loopTask", "async_tcp", "async_udp", "esp_timer", "tiT", "LogTask"};
+
+static void initHistogram(MetricsHistogram &h, const uint32_t *bounds, uint8_t count) {
+    memset(&h, 0, sizeof(h));
+    h.bounds = bounds;
+    h.boundCount = count;
+}
+
+void MetricsHistogram::observe(uint32_t value) {
+    uint8_t i = 0;
+    while (i < boundCount && value > bounds[i]) ++i;
+    buckets[i]++;
+    sum += value;
+    count++;
+}
+
+Metrics::Metrics() {
+    static_assert(COUNT_OF(ROUTE_LABELS) == (size_t)HttpRoute::COUNT, "ROUTE_LABELS unvollständig");
+    static_assert(COUNT_OF(FETCH_LABELS) == (size_t)FetchSource::COUNT, "FETCH_LABELS unvollständig");
+
+    initHistogram(loopTime, LOOP_BOUNDS_US, COUNT_OF(LOOP_BOUNDS_US));
+    initHistogram(pushTime, PUSH_BOUNDS_US, COUNT_OF(PUSH_BOUNDS_US));
+    for (auto &h : http) initHistogram(h, HTTP_BOUNDS_US, COUNT_OF(HTTP_BOUNDS_US));
+    for (auto &h : fetch) initHistogram(h, FETCH_BOUNDS_MS, COUNT_OF(FETCH_BOUNDS_MS));
+}
+
+// ------------------------------------------------------
+// Erfassen (beliebiger Task)
+// ------------------------------------------------------
+uint8_t Metrics::frameSlot() const {
+    if (panelOverride) return METRICS_MODE_OVERRIDE;
+    return mode <= DISPLAYMODES ? mode : DISPLAYMODES;
+}
+
+void Metrics::observeLoop(uint32_t us) {
+    portENTER_CRITICAL(&mux);
+    loopTime.observe(us);
+    if (us > windowLoopMax) windowLoopMax = us;
+    portEXIT_CRITICAL(&mux);
+}
+
+void Metrics::observeDisplayPush(uint32_t us) {
+    uint8_t slot = frameSlot();
+    portENTER_CRITICAL(&mux);
+    pushTime.observe(us);
+    if (us > windowPushMax) windowPushMax = us;
+    presented[slot]++;
+    portEXIT_CRITICAL(&mux);
+}
+
+void Metrics::countSkippedFrame() {
+    // Übersprungen wird immer der eingestellte Modus, nicht die Übernahme
+    uint8_t slot = mode <= DISPLAYMODES ? mode : DISPLAYMODES;
+    portENTER_CRITICAL(&mux);
+    skipped[slot]++;
+    portEXIT_CRITICAL(&mux);
+}
+
+void Metrics::observeHttp(HttpRoute route, uint32_t us) {
+    if (route >= HttpRoute::COUNT) return;
+    portENTER_CRITICAL(&mux);
+    http[(uint8_t)route].observe(us);
+    portEXIT_CRITICAL(&mux);
+}
+
+#ifdef HEAP_PROBE
+void Metrics::observeHttpAllocations(HttpRoute route, uint32_t count) {
+    if (route >= HttpRoute::COUNT || count == 0) return;
+    portENTER_CRITICAL(&mux);
+    httpAllocations[(uint8_t)route] += count;
+    httpAllocatingRequests[(uint8_t)route]++;
+    portEXIT_CRITICAL(&mux);
+}
+#endif
+
+void Metrics::observeFetch(FetchSource source, uint32_t ms, bool ok) {
+    if (source >= FetchSource::COUNT) return;
+    portENTER_CRITICAL(&mux);
+    fetch[(uint8_t)source].observe(ms);
+    if (!ok) fetchFailures[(uint8_t)source]++;
+    portEXIT_CRITICAL(&mux);
+}
+
+void Metrics::recordTaskStack(const char *name, uint32_t freeBytes) {
+    portENTER_CRITICAL(&mux);
+    for (uint8_t i = 0; i < TRANSIENT_TASKS; ++i) {
+        if (transientNames[i] == nullptr || strcmp(transientNames[i], name) == 0) {
+            transientNames[i] = name;
+            transientStack[i] = freeBytes;
+            break;
+        }
+    }
+    portEXIT_CRITICAL(&mux);
+}
+
+MetricsWindow Metrics::takeWindow() {
+    MetricsWindow w;
+    portENTER_CRITICAL(&mux);
+    uint32_t loops = loopTime.count - windowLoopCount;
+    uint32_t pushes = pushTime.count - windowPushCount;
+    w.loopAvgUs = loops ? (uint32_t)((loopTime.sum - windowLoopSum) / loops) : 0;
+    w.pushAvgUs = pushes ? (uint32_t)((pushTime.sum - windowPushSum) / pushes) : 0;
+    w.loopMaxUs = windowLoopMax;
+    w.pushMaxUs = windowPushMax;
+    w.pushCount = pushes;
+    windowLoopSum = loopTime.sum;
+    windowLoopCount = loopTime.count;
+    windowPushSum = pushTime.sum;
+    windowPushCount = pushTime.count;
+    windowLoopMax = 0;
+    windowPushMax = 0;
+    portEXIT_CRITICAL(&mux);
+    return w;
+}
+
+// ------------------------------------------------------
+// Export (AsyncTCP-Task)
+// ------------------------------------------------------
+static void writeHeader(Print &out, const char *name, const char *type, const char *help) {
+    out.printf("# HELP %s %s\n# TYPE %s %s\n", name, help, name, type);
+}
+
+// Werte in µs/ms, ausgegeben in Sekunden (Prometheus-Basiseinheit)
+void Metrics::writeHistogram(Print &out, const char *name, const char *labels,
+                             const MetricsHistogram &h, uint32_t unitsPerSecond) {
+    const char *sep = labels[0] ? "," : "";
+    uint32_t cumulative = 0;
+    for (uint8_t i = 0; i < h.boundCount; ++i) {
+        cumulative += h.buckets[i];
+        out.printf("%s_bucket{%s%sle=\"%g\"} %u\n", name, labels, sep,
+                   (double)h.bounds[i] / unitsPerSecond, cumulative);
+    }
+    out.printf("%s_bucket{%s%sle=\"+Inf\"} %u\n", name, labels, sep, h.count);
+
+    unsigned long long whole = h.sum / unitsPerSecond;
+    unsigned long long frac = h.sum % unitsPerSecond;
+    if (unitsPerSecond == 1000) frac *= 1000;
+    if (labels[0]) {
+        out.printf("%s_sum{%s} %llu.%06llu\n", name, labels, whole, frac);
+        out.printf("%s_count{%s} %u\n", name, labels, h.count);
+    } else {
+        out.printf("%s_sum %llu.%06llu\n", name, whole, frac);
+        out.printf("%s_count %u\n", name, h.count);
+    }
+}
+
+void Metrics::writePrometheus(Print &out) {
+    uint32_t t0 = micros();
+    MetricsHistogram h;
+
+    writeHeader(out, "obegraensad_loop_duration_seconds", "histogram", "Active time per main loop iteration");
+    portENTER_CRITICAL(&mux);
+    h = loopTime;
+    portEXIT_CRITICAL(&mux);
+    writeHistogram(out, "obegraensad_loop_duration_seconds", "", h, 1000000);
+
+    writeHeader(out, "obegraensad_display_push_seconds", "histogram", "Display::update shift-out and latch time");
+    portENTER_CRITICAL(&mux);
+    h = pushTime;
+    portEXIT_CRITICAL(&mux);
+    writeHistogram(out, "obegraensad_display_push_seconds", "", h, 1000000);
+
+    // Frame-Zähler als Kopie, damit presented/skipped zusammenpassen
+    uint32_t framesPresented[MODE_SLOTS], framesSkipped[MODE_SLOTS];
+    portENTER_CRITICAL(&mux);
+    memcpy(framesPresented, presented, sizeof(framesPresented));
+    memcpy(framesSkipped, skipped, sizeof(framesSkipped));
+    portEXIT_CRITICAL(&mux);
+
+    writeHeader(out, "obegraensad_frames_presented_total", "counter", "Frames latched to the panel per display mode");
+    for (uint8_t i = 0; i < MODE_SLOTS; ++i) {
+        if (i == METRICS_MODE_OVERRIDE) out.printf("obegraensad_frames_presented_total{mode=\"override\"} %u\n", framesPresented[i]);
+        else out.printf("obegraensad_frames_presented_total{mode=\"%u\"} %u\n", i, framesPresented[i]);
+    }
+    writeHeader(out, "obegraensad_frames_skipped_total", "counter", "Second ticks not drawn while DDP or OTA owned the panel");
+    for (uint8_t i = 0; i <= DISPLAYMODES; ++i) {
+        out.printf("obegraensad_frames_skipped_total{mode=\"%u\"} %u\n", i, framesSkipped[i]);
+    }
+
+    writeHeader(out, "obegraensad_http_request_duration_seconds", "histogram", "HTTP handler time per route");
+    for (uint8_t i = 0; i < (uint8_t)HttpRoute::COUNT; ++i) {
+        portENTER_CRITICAL(&mux);
+        h = http[i];
+        portEXIT_CRITICAL(&mux);
+        writeHistogram(out, "obegraensad_http_request_duration_seconds", ROUTE_LABELS[i], h, 1000000);
+    }
+#ifdef HEAP_PROBE
+    uint32_t allocations[(uint8_t)HttpRoute::COUNT], allocating[(uint8_t)HttpRoute::COUNT];
+    portENTER_CRITICAL(&mux);
+    memcpy(allocations, httpAllocations, sizeof(allocations));
+    memcpy(allocating, httpAllocatingRequests, sizeof(allocating));
+    portEXIT_CRITICAL(&mux);
+    writeHeader(out, "obegraensad_http_heap_allocations_total", "counter", "Heap allocations inside HTTP handlers (HEAP_PROBE)");
+    for (uint8_t i = 0; i < (uint8_t)HttpRoute::COUNT; ++i) {
+        out.printf("obegraensad_http_heap_allocations_total{%s} %u\n", ROUTE_LABELS[i], allocations[i]);
+    }
+    writeHeader(out, "obegraensad_http_allocating_requests_total", "counter", "HTTP requests that allocated at least once (HEAP_PROBE)");
+    for (uint8_t i = 0; i < (uint8_t)HttpRoute::COUNT; ++i) {
+        out.printf("obegraensad_http_allocating_requests_total{%s} %u\n", ROUTE_LABELS[i], allocating[i]);
+    }
+#endif
+
+    uint32_t failures[(uint8_t)FetchSource::COUNT];
+    writeHeader(out, "obegraensad_fetch_duration_seconds", "histogram", "Weather and OTA network fetch duration");
+    for (uint8_t i = 0; i < (uint8_t)FetchSource::COUNT; ++i) {
+        portENTER_CRITICAL(&mux);
+        h = fetch[i];
+        failures[i] = fetchFailures[i];
+        portEXIT_CRITICAL(&mux);
+        writeHistogram(out, "obegraensad_fetch_duration_seconds", FETCH_LABELS[i], h, 1000);
+    }
+    writeHeader(out, "obegraensad_fetch_failures_total", "counter", "Failed weather and OTA fetches");
+    for (uint8_t i = 0; i < (uint8_t)FetchSource::COUNT; ++i) {
+        out.printf("obegraensad_fetch_failures_total{%s} %u\n", FETCH_LABELS[i], failures[i]);
+    }
+
+    writeHeader(out, "obegraensad_https_handshakes_total", "counter", "TLS handshakes in the HTTPS pool");
+    out.printf("obegraensad_https_handshakes_total %u\n", httpsPool.getHandshakes());
+    writeHeader(out, "obegraensad_https_reuses_total", "counter", "Requests served on a kept-alive TLS connection");
+    out.printf("obegraensad_https_reuses_total %u\n", httpsPool.getReuses());
+
+    // ⚡ Strombudget
+    writeHeader(out, "obegraensad_power_estimated_milliamps", "gauge", "Estimated supply current (lit pixels x PWM duty)");
+    out.printf("obegraensad_power_estimated_milliamps %u\n", powerGovernor.getEstimatedMa());
+    writeHeader(out, "obegraensad_power_budget_milliamps", "gauge", "Configured supply current budget");
+    out.printf("obegraensad_power_budget_milliamps %u\n", (unsigned)POWER_BUDGET_MA);
+    writeHeader(out, "obegraensad_panel_lit_pixels", "gauge", "Lit pixels in the last presented frame");
+    out.printf("obegraensad_panel_lit_pixels %u\n", powerGovernor.getLitPixels());
+    writeHeader(out, "obegraensad_panel_brightness_limit", "gauge", "Brightness cap from the power budget (255 = none)");
+    out.printf("obegraensad_panel_brightness_limit %u\n", powerGovernor.getLimit());
+    writeHeader(out, "obegraensad_power_limited_frames_total", "counter", "Frames presented with reduced brightness");
+    out.printf("obegraensad_power_limited_frames_total %u\n", powerGovernor.getLimitedFrames());
+
+    // 🧠 Heap
+    writeHeader(out, "obegraensad_heap_free_bytes", "gauge", "Free heap");
+    out.printf("obegraensad_heap_free_bytes %u\n", ESP.getFreeHeap());
+    writeHeader(out, "obegraensad_heap_largest_free_block_bytes", "gauge", "Largest allocatable heap block");
+    out.printf("obegraensad_heap_largest_free_block_bytes %u\n", (unsigned)heap_caps_get_largest_free_block(MALLOC_CAP_8BIT));
+    writeHeader(out, "obegraensad_heap_min_free_bytes", "gauge", "Lowest free heap since boot");
+    out.printf("obegraensad_heap_min_free_bytes %u\n", ESP.getMinFreeHeap());
+
+    // 📚 Stack-Reserve (ESP-IDF liefert Bytes)
+    writeHeader(out, "obegraensad_task_stack_free_min_bytes", "gauge", "Stack high-water mark per task");
+    for (const char *name : PERSISTENT_TASKS) {
+        TaskHandle_t task = xTaskGetHandle(name);
+        if (task) out.printf("obegraensad_task_stack_free_min_bytes{task=\"%s\"} %u\n", name, (unsigned)uxTaskGetStackHighWaterMark(task));
+    }
+    const char *names[TRANSIENT_TASKS];
+    uint32_t stacks[TRANSIENT_TASKS];
+    portENTER_CRITICAL(&mux);
+    memcpy(names, transientNames, sizeof(names));
+    memcpy(stacks, transientStack, sizeof(stacks));
+    portEXIT_CRITICAL(&mux);
+    for (uint8_t i = 0; i < TRANSIENT_TASKS; ++i) {
+        if (names[i]) out.printf("obegraensad_task_stack_free_min_bytes{task=\"%s\"} %u\n", names[i], stacks[i]);
+    }
+
+    writeHeader(out, "obegraensad_uptime_seconds", "counter", "Seconds since boot");
+    out.printf("obegraensad_uptime_seconds %lu\n", millis() / 1000);
+    writeHeader(out, "obegraensad_metrics_scrape_seconds", "gauge", "Time spent formatting this response");
+    out.printf("obegraensad_metrics_scrape_seconds %.6f\n", (micros() - t0) / 1e6);
+}
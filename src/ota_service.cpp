@@ -0,0 +1,435 @@
+#include "ota_service.h"
+#include "https_pool.h"
+#include "version.h"
+#include "wifi_manager.h"
+#include "settings_manager.h"
+#include "metrics.h"
+#include "metric_history.h"
+#include "logger.h"
+#include "diagnostics.h"
+#include "display.h"
+#include <HTTPClient.h>
+#include <Update.h>
+#include <esp_ota_ops.h>
+#include <mbedtls/sha256.h>
+#include <esp32/rom/miniz.h>
+
+OtaService otaService;
+
+static uint8_t chunk[OTA_CHUNK_SIZE];
+static uint8_t window[OTA_INFLATE_WINDOW];   // Ausgabe-Ringpuffer für tinfl
+
+static_assert((OTA_INFLATE_WINDOW & (OTA_INFLATE_WINDOW - 1)) == 0, "OTA_INFLATE_WINDOW muss eine Zweierpotenz sein");
+
+// Arduino-Core: Image nicht automatisch beim Start als gültig markieren,
+// das übernimmt OtaService::loop() nach einem gesunden Start
+bool verifyRollbackLater() {
+    return true;
+}
+
+const char* OtaService::stateName(OtaState state) {
+    switch (state) {
+    case OtaState::Checking:    return "checking";
+    case OtaState::Downloading: return "downloading";
+    case OtaState::Verifying:   return "verifying";
+    case OtaState::UpToDate:    return "uptodate";
+    case OtaState::Success:     return "success";
+    case OtaState::Failed:      return "failed";
+    default:                    return "idle";
+    }
+}
+
+void OtaService::begin() {
+    esp_ota_img_states_t state;
+    const esp_partition_t *running = esp_ota_get_running_partition();
+    if (esp_ota_get_state_partition(running, &state) == ESP_OK && state == ESP_OTA_IMG_PENDING_VERIFY) {
+        pendingVerify = true;
+        LOG_INFO(OTA, "Neues Image (%s) wartet auf Bestätigung", CURRENT_VERSION);
+    }
+}
+
+bool OtaService::start() {
+    // Prüfen und Belegen in einem Schritt: Taste (Haupt-Task) und /api/update
+    // (AsyncTCP-Task) dürfen nicht beide durchkommen. Abgelehnt wird auch,
+    // solange der vorige Task noch ausläuft oder nach Erfolg der Neustart ansteht.
+    portENTER_CRITICAL(&statusMux);
+    OtaState s = status.state;
+    if (task != nullptr || s == OtaState::Checking || s == OtaState::Downloading ||
+        s == OtaState::Verifying || s == OtaState::Success) {
+        portEXIT_CRITICAL(&statusMux);
+        return false;
+    }
+    status = {};
+    status.state = OtaState::Checking;
+    portEXIT_CRITICAL(&statusMux);
+
+    // Core 0: TLS/Download neben WLAN-Stack, Anzeige läuft auf Core 1 weiter
+    if (xTaskCreatePinnedToCore(taskEntry, "OTATask", 10240, this, 1, &task, 0) != pdPASS) {
+        setState(OtaState::Failed, "task");
+        return false;
+    }
+    return true;
+}
+
+bool OtaService::isBusy() const {
+    OtaState s = getStatus().state;
+    return s == OtaState::Checking || s == OtaState::Downloading || s == OtaState::Verifying;
+}
+
+OtaStatus OtaService::getStatus() const {
+    portENTER_CRITICAL(&statusMux);
+    OtaStatus copy = status;
+    portEXIT_CRITICAL(&statusMux);
+    return copy;
+}
+
+uint8_t OtaService::getPercent() const {
+    OtaStatus s = getStatus();
+    return s.total ? (uint8_t)((uint64_t)s.downloaded * 100 / s.total) : 0;
+}
+
+void OtaService::setState(OtaState state, const char *message) {
+    portENTER_CRITICAL(&statusMux);
+    status.state = state;
+    if (message) {
+        strncpy(status.message, message, sizeof(status.message) - 1);
+        status.message[sizeof(status.message) - 1] = '\0';
+    }
+    if (state == OtaState::UpToDate || state == OtaState::Success || state == OtaState::Failed)
+        status.finishedAt = millis();
+    portEXIT_CRITICAL(&statusMux);
+
+    if (state == OtaState::Failed) LOG_ERROR(OTA, "Fehler: %s", message ? message : "?");
+}
+
+void OtaService::setProgress(uint32_t downloaded, uint32_t total, uint32_t imageBytes) {
+    portENTER_CRITICAL(&statusMux);
+    status.downloaded = downloaded;
+    status.total = total;
+    status.imageBytes = imageBytes;
+    portEXIT_CRITICAL(&statusMux);
+}
+
+// ------------------------------------------------------
+// Haupt-Task: Rollback-Bestätigung und Neustart
+// ------------------------------------------------------
+void OtaService::loop() {
+    if (pendingVerify) {
+        if (!verifying) {
+            verifying = true;
+            verifyStart = millis();
+            verifyFrames = display.getPresentedCount();
+        }
+        unsigned long running = millis() - verifyStart;
+        uint32_t frames = display.getPresentedCount() - verifyFrames;
+        if (running >= OTA_HEALTHY_AFTER_MS && frames >= OTA_HEALTHY_MIN_FRAMES) {
+            esp_ota_mark_app_valid_cancel_rollback();
+            pendingVerify = false;
+            LOG_INFO(OTA, "Neues Image bestätigt (%u Frames in %lu s, WLAN %s)", frames, running / 1000,
+                     wifiConnection.isConnected() ? "verbunden" : "getrennt");
+        } else if (running >= OTA_ROLLBACK_TIMEOUT_MS) {
+            LOG_WARN(OTA, "Image nicht gesund (%u Frames in %lu s) → Rollback", frames, running / 1000);
+            logger.flush();
+            esp_ota_mark_app_invalid_rollback_and_reboot();
+        }
+    }
+
+    OtaStatus s = getStatus();
+    if (s.state == OtaState::Success && millis() - s.finishedAt >= 1500) {
+        settingsManager.flush();
+        metricHistory.flush();
+        logger.flush();
+        ESP.restart();
+    }
+}
+
+// ------------------------------------------------------
+// OTA-Task
+// ------------------------------------------------------
+void OtaService::taskEntry(void *arg) {
+    OtaService *self = static_cast<OtaService *>(arg);
+    self->run();
+    metrics.recordTaskStack("OTATask", uxTaskGetStackHighWaterMark(NULL));
+    portENTER_CRITICAL(&self->statusMux);
+    self->task = nullptr;
+    portEXIT_CRITICAL(&self->statusMux);
+    vTaskDelete(NULL);
+}
+
+// HTTP/1.1 mit Keep-Alive: version.txt, Prüfsumme und Image liegen hinter
+// denselben zwei Hosts (github.com → CDN), jeder davon braucht nur einen Handshake
+int OtaService::get(WiFiClientSecure *&secure, const char *url) {
+    static const char *headers[] = {"Location"};
+    String target = url;
+    int code = HTTPC_ERROR_CONNECTION_REFUSED;
+
+    for (uint8_t hop = 0; hop <= OTA_MAX_REDIRECTS; ++hop) {
+        bool tls = target.startsWith("https://");
+        for (uint8_t attempt = 0; attempt < 2; ++attempt) {
+            if (tls) {
+                secure = httpsPool.acquire(target);
+                if (!secure) return HTTPC_ERROR_CONNECTION_REFUSED;
+            } else {
+                // plain kennt seinen Host nicht → je Anfrage neu verbinden (nur lokal, kein Handshake)
+                plain.stop();
+            }
+            http.setReuse(true);
+            http.setFollowRedirects(HTTPC_DISABLE_FOLLOW_REDIRECTS);
+            http.collectHeaders(headers, 1);
+            code = http.begin(tls ? (WiFiClient &)*secure : plain, target) ? http.GET() : HTTPC_ERROR_CONNECTION_REFUSED;
+            if (code > 0) break;
+            // Server hat die Keep-Alive-Verbindung inzwischen geschlossen → einmal neu verbinden
+            http.end();
+            httpsPool.release(secure, false);
+            secure = nullptr;
+        }
+        if (code <= 0) return code;
+
+        bool redirect = code == HTTP_CODE_MOVED_PERMANENTLY || code == HTTP_CODE_FOUND ||
+                        code == HTTP_CODE_SEE_OTHER || code == HTTP_CODE_TEMPORARY_REDIRECT ||
+                        code == HTTP_CODE_PERMANENT_REDIRECT;
+        String location = redirect ? http.header("Location") : String();
+        if (location.isEmpty()) return code;
+
+        // Rest der Weiterleitung lesen, damit die Verbindung sauber wiederverwendbar ist
+        http.getString();
+        http.end();
+        httpsPool.release(secure, true);
+        secure = nullptr;
+        target = location;
+    }
+    LOG_WARN(OTA, "%s: zu viele Weiterleitungen", url);
+    return code;
+}
+
+// Kleine Textdatei (version.txt, *.sha256) über den HTTPS-Pool laden
+bool OtaService::fetchText(const char *url, char *out, size_t len) {
+    unsigned long started = millis();
+    WiFiClientSecure *client = nullptr;
+    int code = get(client, url);
+
+    bool ok = code == HTTP_CODE_OK;
+    if (ok) {
+        String body = http.getString();
+        body.trim();
+        strncpy(out, body.c_str(), len - 1);
+        out[len - 1] = '\0';
+    } else {
+        LOG_WARN(OTA, "%s: HTTP %d", url, code);
+    }
+    http.end();
+    // Antwort vollständig gelesen → Verbindung für die nächste Datei behalten
+    httpsPool.release(client, ok);
+    metrics.observeFetch(FetchSource::OtaCheck, millis() - started, ok);
+    diagnostics.recordFetch(FetchSource::OtaCheck, millis() - started, ok);
+    return ok;
+}
+
+void OtaService::run() {
+    unsigned long started = millis();
+    uint32_t handshakes = httpsPool.getHandshakes();
+    uint32_t reuses = httpsPool.getReuses();
+
+    char version[24];
+    if (!fetchText(OTA_VERSION_URL, version, sizeof(version))) {
+        setState(OtaState::Failed, "version.txt");
+        return;
+    }
+    portENTER_CRITICAL(&statusMux);
+    memcpy(status.version, version, sizeof(status.version));
+    portEXIT_CRITICAL(&statusMux);
+    LOG_INFO(OTA, "Online-Version: %s | Lokal: %s", version, CURRENT_VERSION);
+
+    if (strcmp(version, CURRENT_VERSION) == 0) {
+        LOG_INFO(OTA, "Firmware ist aktuell.");
+        setState(OtaState::UpToDate);
+        return;
+    }
+
+    // sha256sum-Format: "<64 Hex-Zeichen>  firmware.bin"
+    char sha[80];
+    if (!fetchText(OTA_SHA256_URL, sha, sizeof(sha)) || strlen(sha) < 64) {
+        setState(OtaState::Failed, "sha256");
+        return;
+    }
+    sha[64] = '\0';
+
+    // Erst komprimiert, bei Fehler (z. B. ältere Release ohne .gz) unkomprimiert
+    unsigned long downloadStarted = millis();
+    const char *error = download(OTA_FIRMWARE_GZ_URL, sha, true);
+    metrics.observeFetch(FetchSource::OtaImage, millis() - downloadStarted, error == nullptr);
+    diagnostics.recordFetch(FetchSource::OtaImage, millis() - downloadStarted, error == nullptr);
+    if (error) {
+        LOG_WARN(OTA, "gzip-Image fehlgeschlagen (%s) → firmware.bin", error);
+        downloadStarted = millis();
+        error = download(OTA_FIRMWARE_URL, sha, false);
+        metrics.observeFetch(FetchSource::OtaImage, millis() - downloadStarted, error == nullptr);
+        diagnostics.recordFetch(FetchSource::OtaImage, millis() - downloadStarted, error == nullptr);
+    }
+
+    OtaStatus s = getStatus();
+    uint32_t duration = millis() - started;
+    LOG_INFO(OTA, "TLS: %u Handshakes, %u Verbindungen wiederverwendet",
+             httpsPool.getHandshakes() - handshakes, httpsPool.getReuses() - reuses);
+    portENTER_CRITICAL(&statusMux);
+    status.durationMs = duration;
+    portEXIT_CRITICAL(&statusMux);
+
+    if (error) {
+        setState(OtaState::Failed, error);
+        return;
+    }
+    LOG_INFO(OTA, "%u Bytes übertragen (%s), Image %u Bytes, %u ms",
+             s.downloaded, s.compressed ? "gzip" : "raw", s.imageBytes, duration);
+    setState(OtaState::Success);
+    LOG_INFO(OTA, "Update abgeschlossen, Neustart folgt");
+}
+
+// gzip-Header (RFC 1952) überspringen; Länge oder 0, wenn ungültig/unvollständig
+static size_t gzipHeaderLength(const uint8_t *p, size_t n) {
+    if (n < 10 || p[0] != 0x1F || p[1] != 0x8B || p[2] != 8) return 0;
+    uint8_t flags = p[3];
+    size_t pos = 10;
+    if (flags & 0x04) pos = (pos + 2 <= n) ? pos + 2 + (p[pos] | (p[pos + 1] << 8)) : n + 1;   // FEXTRA
+    if (flags & 0x08) { while (pos < n && p[pos]) ++pos; ++pos; }                            // FNAME
+    if (flags & 0x10) { while (pos < n && p[pos]) ++pos; ++pos; }                            // FCOMMENT
+    if (flags & 0x02) pos += 2;                                                              // FHCRC
+    return pos <= n ? pos : 0;
+}
+
+const char *OtaService::download(const char *url, const char *expectedSha, bool gzip) {
+    WiFiClientSecure *client = nullptr;
+    int code = get(client, url);
+    if (code <= 0) return "connect";
+
+    int total = http.getSize();
+    if (code != HTTP_CODE_OK || total <= 0) {
+        LOG_WARN(OTA, "%s: HTTP %d, %d Bytes", url, code, total);
+        http.end();
+        httpsPool.release(client, false);
+        return "download";
+    }
+
+    // Entpackte Größe ist erst am Ende bekannt → ganze Partition freigeben
+    tinfl_decompressor *inflator = nullptr;
+    if (gzip) {
+        inflator = (tinfl_decompressor *)malloc(sizeof(tinfl_decompressor));
+        if (!inflator) {
+            http.end();
+            httpsPool.release(client, false);
+            return "no memory";
+        }
+        tinfl_init(inflator);
+    }
+    if (!Update.begin(gzip ? UPDATE_SIZE_UNKNOWN : total)) {
+        free(inflator);
+        http.end();
+        httpsPool.release(client, false);
+        return Update.errorString();
+    }
+
+    portENTER_CRITICAL(&statusMux);
+    status.compressed = gzip;
+    portEXIT_CRITICAL(&statusMux);
+    setProgress(0, total, 0);
+    setState(OtaState::Downloading);
+    LOG_INFO(OTA, "%s: %d Bytes", url, total);
+
+    mbedtls_sha256_context sha;
+    mbedtls_sha256_init(&sha);
+    mbedtls_sha256_starts_ret(&sha, 0);
+
+    WiFiClient *stream = http.getStreamPtr();
+    uint32_t downloaded = 0;
+    uint32_t imageBytes = 0;
+    unsigned long lastData = millis();
+    const char *error = nullptr;
+    bool headerDone = !gzip;
+    bool inflateDone = false;
+    size_t windowPos = 0;
+
+    // Entpackte Bytes → Prüfsumme + OTA-Partition
+    auto writeImage = [&](uint8_t *data, size_t n) {
+        mbedtls_sha256_update_ret(&sha, data, n);
+        if (Update.write(data, n) != n) return false;
+        imageBytes += n;
+        return true;
+    };
+
+    while (!error && downloaded < (uint32_t)total) {
+        size_t avail = stream->available();
+        if (avail == 0) {
+            if (!stream->connected()) { error = "connection lost"; break; }
+            if (millis() - lastData > OTA_STALL_TIMEOUT_MS) { error = "stalled"; break; }
+            vTaskDelay(pdMS_TO_TICKS(2));
+            continue;
+        }
+
+        size_t n = stream->readBytes(chunk, min(avail, sizeof(chunk)));
+        if (n == 0) continue;
+        lastData = millis();
+        downloaded += n;
+
+        if (!gzip) {
+            if (!writeImage(chunk, n)) error = Update.errorString();
+            setProgress(downloaded, total, imageBytes);
+            continue;
+        }
+
+        const uint8_t *in = chunk;
+        size_t inLen = n;
+        if (!headerDone) {
+            size_t header = gzipHeaderLength(chunk, n);
+            if (header == 0) { error = "gzip header"; break; }
+            in += header;
+            inLen -= header;
+            headerDone = true;
+        }
+
+        // Deflate-Strom durch den festen Ringpuffer schieben; Trailer (CRC/Größe)
+        // wird ignoriert, die SHA-256 deckt das entpackte Image ab
+        while (!inflateDone) {
+            size_t inBytes = inLen;
+            size_t outBytes = OTA_INFLATE_WINDOW - windowPos;
+            tinfl_status st = tinfl_decompress(inflator, in, &inBytes, window, window + windowPos, &outBytes,
+                                               downloaded < (uint32_t)total ? TINFL_FLAG_HAS_MORE_INPUT : 0);
+            in += inBytes;
+            inLen -= inBytes;
+
+            if (outBytes && !writeImage(window + windowPos, outBytes)) { error = Update.errorString(); break; }
+            windowPos = (windowPos + outBytes) & (OTA_INFLATE_WINDOW - 1);
+
+            if (st < TINFL_STATUS_DONE) { error = "inflate"; break; }
+            if (st == TINFL_STATUS_DONE) inflateDone = true;
+            if (st == TINFL_STATUS_NEEDS_MORE_INPUT) break;
+        }
+        setProgress(downloaded, total, imageBytes);
+    }
+    if (!error && gzip && !inflateDone) error = "gzip truncated";
+
+    uint8_t digest[32];
+    mbedtls_sha256_finish_ret(&sha, digest);
+    mbedtls_sha256_free(&sha);
+    free(inflator);
+    http.end();
+    httpsPool.release(client, !error);
+
+    if (error) {
+        Update.abort();
+        return error;
+    }
+
+    // Prüfsumme vergleichen, bevor die Partition aktiviert wird
+    setState(OtaState::Verifying);
+    char hex[65];
+    for (uint8_t i = 0; i < 32; ++i) snprintf(hex + i * 2, 3, "%02x", digest[i]);
+    if (strncasecmp(hex, expectedSha, 64) != 0) {
+        LOG_ERROR(OTA, "SHA-256 stimmt nicht: %.16s… != %.16s…", hex, expectedSha);
+        Update.abort();
+        return "sha256 mismatch";
+    }
+
+    if (!Update.end(true)) return Update.errorString();
+    LOG_INFO(OTA, "%u Bytes geschrieben, SHA-256 ok", imageBytes);
+    return nullptr;
+}
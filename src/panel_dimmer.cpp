@@ -0,0 +1,211 @@
+#include "panel_dimmer.h"
+#include <driver/ledc.h>
+#include <esp_idf_version.h>
+#include <math.h>
+
+#define DIMMER_MODE LEDC_HIGH_SPEED_MODE
+#define DIMMER_DUTY_MAX ((1u << DIMMER_PWM_BITS) - 1)
+
+void PanelDimmer::begin(uint8_t pin, uint8_t initial) {
+    level = output = initial;
+
+    ledc_timer_config_t timerConfig = {};
+    timerConfig.speed_mode = DIMMER_MODE;
+    timerConfig.duty_resolution = (ledc_timer_bit_t)DIMMER_PWM_BITS;
+    timerConfig.timer_num = (ledc_timer_t)DIMMER_LEDC_TIMER;
+    timerConfig.freq_hz = DIMMER_PWM_FREQ;
+    timerConfig.clk_cfg = LEDC_AUTO_CLK;
+    ledc_timer_config(&timerConfig);
+
+    // Kanal startet direkt mit der gewünschten Stufe (kein Aufblitzen)
+    ledc_channel_config_t channelConfig = {};
+    channelConfig.gpio_num = pin;
+    channelConfig.speed_mode = DIMMER_MODE;
+    channelConfig.channel = (ledc_channel_t)DIMMER_LEDC_CHANNEL;
+    channelConfig.timer_sel = (ledc_timer_t)DIMMER_LEDC_TIMER;
+    channelConfig.duty = duty(initial);
+    channelConfig.hpoint = 0;
+    ledc_channel_config(&channelConfig);
+    ledc_fade_func_install(0);
+
+    lock = xSemaphoreCreateMutex();
+    owner = xTaskGetCurrentTaskHandle();
+    esp_timer_create_args_t args = {};
+    args.callback = onTimer;
+    args.arg = this;
+    args.name = "dimmer";
+    esp_timer_create(&args, &timer);
+}
+
+uint32_t PanelDimmer::duty(uint8_t value) {
+    if (value == 0) return DIMMER_DUTY_MAX;
+    // Gamma: gleiche Schritte in der Stufe wirken gleich groß; ab Stufe 1 sichtbar
+    uint32_t on = (uint32_t)lroundf(powf(value / 255.0f, DIMMER_GAMMA) * DIMMER_DUTY_MAX);
+    if (on == 0) on = 1;
+    return DIMMER_DUTY_MAX - on;
+}
+
+float PanelDimmer::onFraction(uint8_t value) {
+    return (float)(DIMMER_DUTY_MAX - duty(value)) / DIMMER_DUTY_MAX;
+}
+
+// ------------------------------------------------------
+// Öffentliche API (beliebiger Task)
+// ------------------------------------------------------
+void PanelDimmer::set(uint8_t value) {
+    if (!lock) return;
+    xSemaphoreTake(lock, portMAX_DELAY);
+    level = value;
+    cancel();
+    writeNow(value);
+    xSemaphoreGive(lock);
+}
+
+void PanelDimmer::fadeTo(uint8_t value, uint16_t ms) {
+    if (!lock) return;
+    xSemaphoreTake(lock, portMAX_DELAY);
+    level = value;
+    startFade(output, value, ms, false);
+    xSemaphoreGive(lock);
+}
+
+void PanelDimmer::show(uint8_t value) {
+    if (!lock) return;
+    xSemaphoreTake(lock, portMAX_DELAY);
+    cancel();
+    writeNow(value);
+    xSemaphoreGive(lock);
+}
+
+void PanelDimmer::flash(uint8_t from, uint8_t to, uint16_t ms) {
+    if (!lock) return;
+    xSemaphoreTake(lock, portMAX_DELAY);
+    startFade(from, to, ms, true);
+    xSemaphoreGive(lock);
+}
+
+void PanelDimmer::restore(uint16_t ms) {
+    if (!lock) return;
+    xSemaphoreTake(lock, portMAX_DELAY);
+    startFade(output, level, ms, false);
+    xSemaphoreGive(lock);
+}
+
+void PanelDimmer::setLimit(uint8_t cap, uint16_t ms) {
+    if (!lock || cap == limit) return;
+    xSemaphoreTake(lock, portMAX_DELAY);
+    uint8_t shown = min(output, limit);
+    bool lower = cap < limit;
+    limit = cap;
+
+    if (lower && fading) {
+        // Nicht bis zum nächsten Teilstück warten: Übergang anhalten, gekappten
+        // Duty setzen, Rest des Übergangs unter der neuen Grenze fortsetzen
+        Fade rest = fade;
+        cancel();
+        writeCapped();
+        uint8_t left = rest.segments - rest.segment - 1;
+        if (left) startFade(output, rest.to, left * rest.segmentMs, rest.restoreAfter);
+        else if (rest.restoreAfter && output != level) startFade(output, level, DIMMER_RESTORE_MS, false);
+    } else if (lower) {
+        if (output > limit) writeCapped();
+    } else if (!fading && output > shown) {
+        // Lockern als eigener Übergang von der gezeigten Stufe zurück zu output:
+        // so bleibt er abbrechbar, falls die Grenze gleich wieder sinkt
+        startFade(shown, output, ms, false);
+    }
+    xSemaphoreGive(lock);
+}
+
+void PanelDimmer::loop() {
+    if (!segmentDue.exchange(false)) return;
+    xSemaphoreTake(lock, portMAX_DELAY);
+    advance();
+    xSemaphoreGive(lock);
+}
+
+// ------------------------------------------------------
+// Intern (lock gehalten)
+// ------------------------------------------------------
+void PanelDimmer::cancel() {
+    if (!fading) return;
+    fading = false;
+    esp_timer_stop(timer);
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 0, 0)
+    ledc_fade_stop(DIMMER_MODE, (ledc_channel_t)DIMMER_LEDC_CHANNEL);
+#endif
+    // Ohne ledc_fade_stop (IDF 4.x) wartet der nächste Schreibzugriff,
+    // bis das laufende Teilstück fertig ist (höchstens 1/DIMMER_MAX_SEGMENTS);
+    // als aktuelle Stufe gilt das Ziel dieses Teilstücks
+    int span = (int)fade.to - fade.from;
+    output = fade.from + span * (fade.segment + 1) / fade.segments;
+}
+
+void PanelDimmer::writeNow(uint8_t value) {
+    output = value;
+    ledc_set_duty_and_update(DIMMER_MODE, (ledc_channel_t)DIMMER_LEDC_CHANNEL, duty(min(value, limit)), 0);
+}
+
+// Sofort, ohne Fade; nach cancel() unter IDF 4.x erst, wenn das laufende
+// Teilstück in der Hardware fertig ist (höchstens eines von DIMMER_MAX_SEGMENTS)
+void PanelDimmer::writeCapped() {
+    ledc_set_duty(DIMMER_MODE, (ledc_channel_t)DIMMER_LEDC_CHANNEL, duty(min(output, limit)));
+    ledc_update_duty(DIMMER_MODE, (ledc_channel_t)DIMMER_LEDC_CHANNEL);
+}
+
+void PanelDimmer::startFade(uint8_t from, uint8_t to, uint16_t ms, bool restoreAfter) {
+    cancel();
+    if (from != output) writeNow(from);
+    if (ms == 0 || from == to) {
+        writeNow(to);
+        if (restoreAfter && to != level) startFade(to, level, DIMMER_RESTORE_MS, false);
+        return;
+    }
+
+    uint8_t segments = constrain(ms / DIMMER_SEGMENT_MS, 1, DIMMER_MAX_SEGMENTS);
+    fade.from = from;
+    fade.to = to;
+    fade.segments = segments;
+    fade.segment = 0;
+    fade.segmentMs = ms / segments;
+    fade.restoreAfter = restoreAfter;
+    fading = true;
+    startSegment();
+}
+
+// Teilstück i: Stufe linear von L(i) nach L(i+1), die Hardware blendet den Duty
+void PanelDimmer::startSegment() {
+    int span = (int)fade.to - fade.from;
+    uint8_t target = fade.from + span * (fade.segment + 1) / fade.segments;
+    ledc_set_fade_with_time(DIMMER_MODE, (ledc_channel_t)DIMMER_LEDC_CHANNEL, duty(min(target, limit)), fade.segmentMs);
+    ledc_fade_start(DIMMER_MODE, (ledc_channel_t)DIMMER_LEDC_CHANNEL, LEDC_FADE_NO_WAIT);
+    fade.segmentEndUs = esp_timer_get_time() + (int64_t)fade.segmentMs * 1000;
+    esp_timer_start_once(timer, (uint64_t)fade.segmentMs * 1000);
+}
+
+// Teilstück abgelaufen: nächstes starten bzw. Übergang abschließen
+void PanelDimmer::advance() {
+    // Verspäteter Aufruf eines inzwischen ersetzten Übergangs → ignorieren
+    if (!fading || esp_timer_get_time() < fade.segmentEndUs - 1000) return;
+    int span = (int)fade.to - fade.from;
+    output = fade.from + span * (fade.segment + 1) / fade.segments;
+    if (++fade.segment < fade.segments) {
+        startSegment();
+    } else {
+        fading = false;
+        if (fade.restoreAfter && output != level) startFade(output, level, DIMMER_RESTORE_MS, false);
+    }
+}
+
+// esp_timer-Task: nie blockieren (sonst verspätet sich auch der Sekundentakt).
+// Hält gerade ein Task den Lock, übernimmt der Haupt-Task das Teilstück
+void PanelDimmer::onTimer(void *arg) {
+    PanelDimmer *self = static_cast<PanelDimmer *>(arg);
+    if (xSemaphoreTake(self->lock, 0) == pdTRUE) {
+        self->advance();
+        xSemaphoreGive(self->lock);
+    } else {
+        self->segmentDue = true;
+        if (self->owner) xTaskNotifyGive(self->owner);
+    }
+}
@@ -0,0 +1,126 @@
+#include "pixel_receiver.h"
+#include "display.h"
+#include "logger.h"
+
+PixelReceiver pixelReceiver;
+
+// Datentyp-Byte: C R TTT SSS (TTT = Typ, SSS = Bits pro Element)
+static constexpr uint8_t DDP_TYPE_RGB = 1;
+static constexpr uint8_t DDP_TYPE_GRAY = 4;
+static constexpr uint8_t DDP_SIZE_1BIT = 1;
+static constexpr uint8_t DDP_SIZE_8BIT = 3;
+
+static inline void setBit(uint8_t *frame, uint16_t pixel, bool on) {
+    uint8_t mask = 0x80 >> (pixel & 7);
+    if (on) frame[pixel >> 3] |= mask;
+    else frame[pixel >> 3] &= ~mask;
+}
+
+void PixelReceiver::begin(uint16_t port) {
+    if (!udp.listen(port)) {
+        LOG_ERROR(DDP, "Port %u konnte nicht geöffnet werden", port);
+        return;
+    }
+    udp.onPacket([this](AsyncUDPPacket &packet) { onPacket(packet); });
+    LOG_INFO(DDP, "Empfang auf UDP-Port %u", port);
+}
+
+// ------------------------------------------------------
+// UDP-Task: Paket prüfen und direkt in den back-Puffer dekodieren
+// ------------------------------------------------------
+void PixelReceiver::onPacket(AsyncUDPPacket &packet) {
+    const uint8_t *p = packet.data();
+    size_t len = packet.length();
+    if (len < DDP_HEADER_LEN) return;
+
+    uint8_t flags = p[0];
+    if ((flags & 0xC0) != DDP_FLAG_VER1) return;   // nur DDP v1
+    if (flags & DDP_FLAG_QUERY) return;            // Status-/Config-Abfragen ignorieren
+
+    size_t header = (flags & DDP_FLAG_TIMECODE) ? DDP_HEADER_LEN + 4 : DDP_HEADER_LEN;
+    uint32_t offset = ((uint32_t)p[4] << 24) | ((uint32_t)p[5] << 16) | ((uint32_t)p[6] << 8) | p[7];
+    uint16_t dataLen = ((uint16_t)p[8] << 8) | p[9];
+    if (len < header + dataLen) return;
+
+    // Sequenznummer 1..15 (0 = nicht verwendet); Lücken zählen als verlorene Pakete
+    uint8_t seq = p[1] & 0x0F;
+    if (seq != 0 && lastSeq != 0) {
+        uint8_t expected = (lastSeq % 15) + 1;
+        if (seq != expected) dropped += (seq + 15 - expected) % 15;
+    }
+    if (seq != 0) lastSeq = seq;
+
+    bool complete = decode(p + header, dataLen, offset, p[2]);
+    lastPacketMs.store(millis());
+
+    // PUSH = Frame komplett; Sender ohne PUSH: Frame bis zum letzten Pixel gefüllt
+    if ((flags & DDP_FLAG_PUSH) || complete) publish();
+}
+
+// true, wenn das Paket den Frame bis zum letzten Pixel füllt
+bool PixelReceiver::decode(const uint8_t *data, size_t len, uint32_t offset, uint8_t dataType) {
+    uint8_t *frame = buffers[back];
+    uint8_t type = (dataType >> 3) & 0x07;
+    uint8_t size = dataType & 0x07;
+    const uint16_t pixels = DISPLAY_WIDTH * DISPLAY_HEIGHT;
+
+    if (size == DDP_SIZE_1BIT) {
+        // Bereits gepackt → direkt übernehmen
+        if (offset >= PIXEL_FRAME_BYTES) return false;
+        memcpy(frame + offset, data, min(len, (size_t)(PIXEL_FRAME_BYTES - offset)));
+        return offset + len >= PIXEL_FRAME_BYTES;
+    }
+    if (type == DDP_TYPE_GRAY && size == DDP_SIZE_8BIT) {
+        for (size_t i = 0; i < len && offset + i < pixels; ++i)
+            setBit(frame, offset + i, data[i] >= 128);
+        return offset + len >= pixels;
+    }
+    if (type == DDP_TYPE_RGB || dataType == 0x00) {
+        // RGB (auch Typ 0x00 = undefiniert, wie bei älteren Sendern; 0x01 ist
+        // dagegen 1 bpp, siehe oben): Luminanz ≈ (2R + 5G + B) / 8
+        if (offset % 3 != 0) return false;
+        uint16_t pixel = offset / 3;
+        for (size_t i = 0; i + 2 < len && pixel < pixels; i += 3, ++pixel) {
+            uint16_t lum = (2 * data[i] + 5 * data[i + 1] + data[i + 2]) >> 3;
+            setBit(frame, pixel, lum >= 128);
+        }
+        return pixel >= pixels;
+    }
+    return false;
+}
+
+void PixelReceiver::publish() {
+    uint8_t prev = middle.exchange(back | FRAME_NEW);
+    if (prev & FRAME_NEW) skipped++;   // vorheriger Frame wurde nie angezeigt
+    back = prev & 0x03;
+    frames++;
+}
+
+// ------------------------------------------------------
+// Haupt-Task: neuesten Frame anzeigen, Timeout überwachen
+// ------------------------------------------------------
+bool PixelReceiver::update() {
+    uint32_t last = lastPacketMs.load();
+    bool streaming = last != 0 && millis() - last < DDP_TIMEOUT_MS;
+
+    if (streaming != active) {
+        active = streaming;
+        LOG_INFO(DDP, "Stream %s (Frames %u, verloren %u, übersprungen %u)",
+                 active ? "gestartet" : "beendet", frames, dropped, skipped);
+        if (!active) fps = 0;
+    }
+    if (!active) return false;
+
+    if (middle.load() & FRAME_NEW) {
+        front = middle.exchange(front) & 0x03;
+        display.drawBitmap(buffers[front]);
+        framesThisSecond++;
+    }
+
+    if (millis() - fpsWindowStart >= 1000) {
+        fps = framesThisSecond;
+        framesThisSecond = 0;
+        fpsWindowStart = millis();
+    }
+    return true;
+}
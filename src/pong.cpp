@@ -1,4 +1,5 @@
 #include "pong.h"
+#include "logger.h"
 
 Pong::Pong()
     : running(false),
@@ -18,14 +19,14 @@ void Pong::start() {
     velY = 0.6f;
     paddleTopX = 6;
     paddleBottomX = 6;
-    Serial.println("[Pong] gestartet (endlos)");
+    LOG_INFO(Game, "Pong gestartet (endlos)");
 }
 
 void Pong::stop() {
     running = false;
     display.clear();
     display.update();
-    Serial.println("[Pong] gestoppt");
+    LOG_INFO(Game, "Pong gestoppt");
 }
 
 void Pong::update() {
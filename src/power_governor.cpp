@@ -0,0 +1,48 @@
+#include "power_governor.h"
+#include <math.h>
+
+PowerGovernor powerGovernor;
+
+void PowerGovernor::onFrame(const uint8_t frame[32], PanelDimmer &panel) {
+    dimmer = &panel;
+
+    uint16_t count = 0;
+    for (uint8_t i = 0; i < 32; i += 4) {
+        uint32_t word;
+        memcpy(&word, frame + i, sizeof(word));
+        count += __builtin_popcount(word);
+    }
+    lit.store(count);
+
+    // Herunter sofort (Frame wird erst danach gelatcht), hinauf gedämpft
+    uint8_t cap = capFor(count);
+    uint8_t current = panel.getLimit();
+    if (cap < current) {
+        panel.setLimit(cap, 0);
+    } else if (cap > current && (cap == 255 || cap - current >= POWER_RELEASE_STEP)) {
+        panel.setLimit(cap, POWER_RELEASE_MS);
+    }
+    if (panel.isLimited()) limitedFrames.fetch_add(1);
+}
+
+uint32_t PowerGovernor::getEstimatedMa() const {
+    return estimateMa(lit.load(), dimmer ? dimmer->getEffective() : 0);
+}
+
+// Höchste Stufe, bei der litPixels LEDs im Budget bleiben
+uint8_t PowerGovernor::capFor(uint16_t litPixels) {
+    if (litPixels == 0) return 255;
+    float available = (float)POWER_BUDGET_MA - POWER_IDLE_MA;
+    if (available <= 0) return 1;
+    float fraction = available / ((float)litPixels * POWER_LED_MA);
+    if (fraction >= 1.0f) return 255;
+    // Einschaltanteil → Stufe über die Gammakurve des Dimmers, dann so weit
+    // zurück, bis die Rundung des Duty-Werts nicht mehr darüber liegt
+    int cap = (int)(255.0f * powf(fraction, 1.0f / DIMMER_GAMMA));
+    while (cap > 1 && PanelDimmer::onFraction(cap) > fraction) --cap;
+    return (uint8_t)max(cap, 1);
+}
+
+uint32_t PowerGovernor::estimateMa(uint16_t litPixels, uint8_t level) {
+    return POWER_IDLE_MA + (uint32_t)lroundf(litPixels * POWER_LED_MA * PanelDimmer::onFraction(level));
+}
@@ -0,0 +1,173 @@
+#include "profiler.h"
+
+#ifdef PROFILING
+
+#include <stdio.h>
+#include <string.h>
+
+#if defined(ARDUINO) || defined(ESP_PLATFORM)
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+static portMUX_TYPE profileMux = portMUX_INITIALIZER_UNLOCKED;
+#define PROFILE_LOCK() portENTER_CRITICAL(&profileMux)
+#define PROFILE_UNLOCK() portEXIT_CRITICAL(&profileMux)
+static const char *currentTaskName() { return pcTaskGetName(NULL); }
+#else
+#include <mutex>
+static std::mutex profileMutex;
+#define PROFILE_LOCK() profileMutex.lock()
+#define PROFILE_UNLOCK() profileMutex.unlock()
+static const char *currentTaskName() { return "host"; }
+#endif
+
+Profiler profiler;
+
+// Knoten 0 = gemeinsame Wurzel, darunter ein Knoten pro Task
+#define PROFILE_MAX_TASKS 8
+#define PROFILE_TASK_NAME_LEN 16
+static char taskNames[PROFILE_MAX_TASKS][PROFILE_TASK_NAME_LEN];
+static uint8_t taskNameCount = 0;
+
+// Offene Zonen des aktuellen Tasks (-1 = nicht erfasst, Tabelle voll)
+struct ProfileContext {
+    int16_t root = -1;
+    uint8_t depth = 0;
+    int16_t stack[PROFILE_MAX_DEPTH];
+};
+static thread_local ProfileContext context;
+
+static bool sameName(const char *a, const char *b) {
+    return a == b || strcmp(a, b) == 0;
+}
+
+int16_t Profiler::findOrAdd(int16_t parent, const char *name) {
+    // Lesen ohne Lock: Knoten werden nur angehängt, nie entfernt
+    for (int16_t i = nodes[parent].firstChild.load(std::memory_order_acquire); i >= 0; i = nodes[i].nextSibling) {
+        if (sameName(nodes[i].name, name)) return i;
+    }
+
+    PROFILE_LOCK();
+    int16_t found = -1;
+    for (int16_t i = nodes[parent].firstChild.load(std::memory_order_relaxed); i >= 0; i = nodes[i].nextSibling) {
+        if (sameName(nodes[i].name, name)) { found = i; break; }
+    }
+    uint16_t count = nodeCount.load(std::memory_order_relaxed);
+    if (found < 0 && count < PROFILE_MAX_NODES) {
+        Node &n = nodes[count];
+        n.name = name;
+        n.parent = parent;
+        n.firstChild.store(-1, std::memory_order_relaxed);
+        n.nextSibling = nodes[parent].firstChild.load(std::memory_order_relaxed);
+        n.cycles = 0;
+        n.calls = 0;
+        found = count;
+        nodeCount.store(count + 1, std::memory_order_release);
+        nodes[parent].firstChild.store(found, std::memory_order_release);
+    }
+    PROFILE_UNLOCK();
+    return found;
+}
+
+Profiler::Profiler() {
+    nodes[0].name = "all";
+    nodes[0].parent = -1;
+    nodes[0].firstChild.store(-1, std::memory_order_relaxed);
+    nodes[0].nextSibling = -1;
+    nodes[0].cycles = 0;
+    nodes[0].calls = 0;
+    nodeCount.store(1, std::memory_order_release);
+}
+
+int16_t Profiler::taskRoot() {
+    // Tasknamen kopieren: kurzlebige Tasks geben ihren TCB wieder frei
+    const char *name = currentTaskName();
+    const char *stored = nullptr;
+    PROFILE_LOCK();
+    for (uint8_t i = 0; i < taskNameCount && !stored; ++i) {
+        if (strcmp(taskNames[i], name) == 0) stored = taskNames[i];
+    }
+    if (!stored && taskNameCount < PROFILE_MAX_TASKS) {
+        strncpy(taskNames[taskNameCount], name, PROFILE_TASK_NAME_LEN - 1);
+        stored = taskNames[taskNameCount++];
+    }
+    PROFILE_UNLOCK();
+    return stored ? findOrAdd(0, stored) : -1;
+}
+
+void Profiler::enter(const char *name) {
+    ProfileContext &ctx = context;
+    if (ctx.root < 0) ctx.root = taskRoot();
+
+    int16_t node = -1;
+    if (ctx.depth < PROFILE_MAX_DEPTH) {
+        int16_t parent = ctx.depth ? ctx.stack[ctx.depth - 1] : ctx.root;
+        if (parent >= 0) node = findOrAdd(parent, name);
+        ctx.stack[ctx.depth] = node;
+    }
+    if (node < 0) overflows.fetch_add(1, std::memory_order_relaxed);
+    ctx.depth++;
+}
+
+void Profiler::leave(uint32_t elapsed) {
+    ProfileContext &ctx = context;
+    if (ctx.depth == 0) return;
+    ctx.depth--;
+    if (ctx.depth >= PROFILE_MAX_DEPTH) return;
+    int16_t node = ctx.stack[ctx.depth];
+    if (node < 0) return;
+    // Nur der eigene Task schreibt in seine Knoten
+    nodes[node].cycles += elapsed;
+    nodes[node].calls++;
+}
+
+void Profiler::reset() {
+    uint16_t count = nodeCount.load(std::memory_order_acquire);
+    for (uint16_t i = 0; i < count; ++i) {
+        nodes[i].cycles = 0;
+        nodes[i].calls = 0;
+    }
+    overflows.store(0);
+}
+
+// Eine Zeile pro Knoten: "task;zone;zone <Selbst-Zyklen>"
+size_t Profiler::writeFolded(char *out, size_t len) const {
+    if (len == 0) return 0;
+    size_t pos = 0;
+    out[0] = '\0';
+    uint16_t count = nodeCount.load(std::memory_order_acquire);
+
+    for (uint16_t i = 1; i < count; ++i) {
+        const Node &n = nodes[i];
+        if (n.parent == 0) continue;   // Task-Knoten selbst wird nicht gemessen
+
+        uint64_t self = n.cycles;
+        for (int16_t c = n.firstChild.load(std::memory_order_acquire); c >= 0; c = nodes[c].nextSibling) {
+            self -= nodes[c].cycles < self ? nodes[c].cycles : self;
+        }
+        if (self == 0) continue;
+
+        // Pfad von der Wurzel aus zusammensetzen
+        int16_t path[PROFILE_MAX_DEPTH + 1];
+        uint8_t depth = 0;
+        for (int16_t p = i; p > 0 && depth < sizeof(path) / sizeof(path[0]); p = nodes[p].parent) path[depth++] = p;
+
+        size_t lineStart = pos;
+        for (int8_t d = depth - 1; d >= 0 && pos < len; --d) {
+            int w = snprintf(out + pos, len - pos, d ? "%s;" : "%s", nodes[path[d]].name);
+            pos += w > 0 ? (size_t)w : 0;
+        }
+        if (pos < len) {
+            int w = snprintf(out + pos, len - pos, " %llu\n", (unsigned long long)self);
+            pos += w > 0 ? (size_t)w : 0;
+        }
+        if (pos >= len) {
+            // Zeile passt nicht mehr → abschneiden, Ausgabe bleibt gültig
+            pos = lineStart;
+            out[pos] = '\0';
+            break;
+        }
+    }
+    return pos;
+}
+
+#endif
@@ -1,5 +1,6 @@
 #include "settings_manager.h"
 #include "config.h"
+#include "logger.h"
 
 SettingsManager settingsManager;
 
@@ -21,8 +22,9 @@ SettingsManager::SettingsManager() {
 //  Initialisierung
 // =========================================
 bool SettingsManager::begin() {
-    if (!EEPROM.begin(EEPROM_SIZE)) {
-        Serial.println("❌ [Settings] EEPROM-Init fehlgeschlagen!");
+    prefsOpen = prefs.begin(SETTINGS_NVS_NAMESPACE, false);
+    if (!prefsOpen) {
+        LOG_ERROR(Settings, "NVS-Init fehlgeschlagen!");
         return false;
     }
 
@@ -31,38 +33,138 @@ bool SettingsManager::begin() {
 }
 
 // =========================================
-//  Laden aus EEPROM
+//  Laden aus NVS (einmalig Migration aus EEPROM)
 // =========================================
 void SettingsManager::load() {
-    EEPROM.get(EEPROM_ADDR, settings);
+    if (!prefs.isKey("ver")) {
+        if (migrateFromEEPROM()) {
+            LOG_INFO(Settings, "Aus EEPROM nach NVS übernommen");
+            beginWrite();
+            markDirty(DIRTY_ALL);
+            endWrite();
+            save();
+        } else {
+            LOG_WARN(Settings, "Keine gespeicherten Daten – Standardwerte laden.");
+            reset();
+        }
+        return;
+    }
+
+    Settings loaded;
+    loaded.version = EEPROM_VERSION;
+    loaded.magic = EEPROM_MAGIC;
+    loaded.brightness = prefs.getUChar("bright", DEFAULT_BRIGHTNESS);
+    loaded.displayMode = prefs.getUChar("mode", DEFAULT_MODE);
+    loaded.autoSync = prefs.getBool("sync", DEFAULT_AUTOSYNC);
+    prefs.getString("city", loaded.city, CITY_MAX_LEN);
+    loaded.city[CITY_MAX_LEN - 1] = '\0';
 
-    if (!validate()) {
-        Serial.println("⚠️  [Settings] Ungültige Daten – Standardwerte laden.");
+    beginWrite();
+    settings = loaded;
+    endWrite();
+    flashWrites = prefs.getUInt("writes", 0);
+    flushCount = prefs.getUInt("flushes", 0);
+
+    if (prefs.getUChar("ver", 0) != SETTINGS_NVS_VERSION || !validate()) {
+        LOG_WARN(Settings, "Ungültige Daten – Standardwerte laden.");
         reset();
     } else {
-        Serial.println("✅ [Settings] Geladen:");
-        Serial.printf("   Version: %d\n", settings.version);
-        Serial.printf("   Helligkeit: %d\n", settings.brightness);
-        Serial.printf("   Modus: %d\n", settings.displayMode);
-        Serial.printf("   AutoSync: %s\n", settings.autoSync ? "Ja" : "Nein");
+        LOG_INFO(Settings, "Geladen: Helligkeit %d, Modus %d, AutoSync %s, Flash-Schreibvorgänge %u (%u Flushes)",
+                 settings.brightness, settings.displayMode, settings.autoSync ? "Ja" : "Nein", flashWrites, flushCount);
     }
 }
 
+bool SettingsManager::migrateFromEEPROM() {
+    if (!EEPROM.begin(EEPROM_SIZE)) return false;
+    Settings legacy;
+    EEPROM.get(EEPROM_ADDR, legacy);
+    EEPROM.end();
+    // "Display aus" ist inzwischen DISPLAYMODES (Vorhersage-Modus davor eingefügt)
+    if (legacy.displayMode == EEPROM_MODE_OFF) legacy.displayMode = DISPLAYMODES;
+
+    beginWrite();
+    settings = legacy;
+    endWrite();
+    return validate();
+}
+
 // =========================================
-//  Speichern in EEPROM
+//  Speichern in NVS (nur geänderte Schlüssel)
 // =========================================
 void SettingsManager::save() {
-    settings.magic = EEPROM_MAGIC;
-    settings.version = EEPROM_VERSION;
-    EEPROM.put(EEPROM_ADDR, settings);
-    EEPROM.commit();
-    Serial.println("💾 [Settings] Gespeichert");
+    if (!prefsOpen) return;
+
+    // Geänderte Felder + konsistente Kopie übernehmen, dann ohne Sperre schreiben
+    portENTER_CRITICAL(&writeMux);
+    uint8_t mask = dirtyMask;
+    dirtyMask = 0;
+    portEXIT_CRITICAL(&writeMux);
+    if (mask == 0) return;
+    Settings s = snapshot();
+
+    uint8_t keys = 0;
+    if (mask & DIRTY_BRIGHTNESS) { prefs.putUChar("bright", s.brightness); keys++; }
+    if (mask & DIRTY_MODE)       { prefs.putUChar("mode", s.displayMode); keys++; }
+    if (mask & DIRTY_AUTOSYNC)   { prefs.putBool("sync", s.autoSync); keys++; }
+    if (mask & DIRTY_CITY)       { prefs.putString("city", s.city); keys++; }
+    if (prefs.getUChar("ver", 0) != SETTINGS_NVS_VERSION) { prefs.putUChar("ver", SETTINGS_NVS_VERSION); keys++; }
+
+    // Zähler selbst zählen mit
+    flushCount++;
+    flashWrites += keys + 2;
+    prefs.putUInt("writes", flashWrites);
+    prefs.putUInt("flushes", flushCount);
+
+    LOG_INFO(Settings, "Gespeichert (%d Schlüssel)", keys);
+}
+
+void SettingsManager::flush() {
+    save();
+}
+
+void SettingsManager::loop() {
+    if (dirtyMask != 0 && millis() - lastChange >= SETTINGS_FLUSH_DELAY_MS) {
+        save();
+    }
+}
+
+// Nur innerhalb beginWrite()/endWrite() aufrufen
+void SettingsManager::markDirty(uint8_t bits) {
+    dirtyMask |= bits;
+    lastChange = millis();
+}
+
+// =========================================
+//  Seqlock: Schreiber serialisiert, Leser ohne Sperre
+// =========================================
+void SettingsManager::beginWrite() {
+    portENTER_CRITICAL(&writeMux);
+    seq.fetch_add(1, std::memory_order_relaxed);   // → ungerade
+    std::atomic_thread_fence(std::memory_order_release);
+}
+
+void SettingsManager::endWrite(bool changed) {
+    if (changed) seq.fetch_add(1, std::memory_order_release);   // → gerade, neue Version
+    else seq.fetch_sub(1, std::memory_order_release);           // → gerade, Version wie zuvor
+    portEXIT_CRITICAL(&writeMux);
+}
+
+Settings SettingsManager::snapshot() const {
+    Settings copy;
+    for (;;) {
+        uint32_t before = seq.load(std::memory_order_acquire);
+        if (before & 1) continue;   // Schreiber aktiv (anderer Kern) → erneut
+        memcpy(&copy, (const void *)&settings, sizeof(copy));
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (seq.load(std::memory_order_relaxed) == before) return copy;
+    }
 }
 
 // =========================================
 //  Reset auf Defaultwerte
 // =========================================
 void SettingsManager::reset() {
+    beginWrite();
     settings.version = EEPROM_VERSION;
     settings.brightness = DEFAULT_BRIGHTNESS;
     settings.displayMode = DEFAULT_MODE;
@@ -70,8 +172,10 @@ void SettingsManager::reset() {
     strncpy(settings.city, CITY, CITY_MAX_LEN - 1);
     settings.city[CITY_MAX_LEN - 1] = '\0';
     settings.magic = EEPROM_MAGIC;
+    markDirty(DIRTY_ALL);
+    endWrite();
     save();
-    Serial.println("🔄 [Settings] Zurückgesetzt");
+    LOG_INFO(Settings, "Zurückgesetzt");
 }
 
 // =========================================
@@ -87,61 +191,81 @@ bool SettingsManager::validate() {
 }
 
 // =========================================
-//  Getter / Setter
+//  Getter / Setter (Lesen lock-frei über snapshot())
 // =========================================
 
-uint8_t SettingsManager::getBrightness() { return settings.brightness; }
+uint8_t SettingsManager::getBrightness() { return snapshot().brightness; }
 
 void SettingsManager::setBrightness(uint8_t value) {
-    if (value >= 10 && value <= 255 && value != settings.brightness) {
+    if (value < 10 || value > 255) {
+        LOG_WARN(Settings, "Ungültige Helligkeit (10–255)");
+        return;
+    }
+    beginWrite();
+    bool changed = value != settings.brightness;
+    if (changed) {
         settings.brightness = value;
-        save();
-        Serial.printf("[Settings] Neue Helligkeit: %d\n", value);
-    } else {
-        if (value < 10 || value > 255)
-            Serial.println("⚠️  [Settings] Ungültige Helligkeit (10–255)");
+        markDirty(DIRTY_BRIGHTNESS);
     }
+    endWrite(changed);
+    if (changed) LOG_INFO(Settings, "Neue Helligkeit: %d", value);
 }
 
-uint8_t SettingsManager::getDisplayMode() { return settings.displayMode; }
+uint8_t SettingsManager::getDisplayMode() { return snapshot().displayMode; }
 
 void SettingsManager::setDisplayMode(uint8_t mode) {
-    if (mode <= DISPLAYMODES && mode != settings.displayMode) {
+    if (mode > DISPLAYMODES) return;
+    beginWrite();
+    bool changed = mode != settings.displayMode;
+    if (changed) {
         settings.displayMode = mode;
-        save();
-        Serial.printf("[Settings] Neuer Modus: %d\n", mode);
+        markDirty(DIRTY_MODE);
     }
+    endWrite(changed);
+    if (changed) LOG_INFO(Settings, "Neuer Modus: %d", mode);
 }
 
-bool SettingsManager::getAutoSync() { return settings.autoSync; }
+bool SettingsManager::getAutoSync() { return snapshot().autoSync; }
 
 void SettingsManager::setAutoSync(bool enabled) {
-    if (settings.autoSync != enabled) {
+    beginWrite();
+    bool changed = settings.autoSync != enabled;
+    if (changed) {
         settings.autoSync = enabled;
-        save();
-        Serial.printf("[Settings] AutoSync: %s\n", enabled ? "An" : "Aus");
+        markDirty(DIRTY_AUTOSYNC);
     }
+    endWrite(changed);
+    if (changed) LOG_INFO(Settings, "AutoSync: %s", enabled ? "An" : "Aus");
 }
 
 // =========================================
 //  Stadt (Wetter) Getter / Setter
 // =========================================
-String SettingsManager::getCity() { return String(settings.city); }
+String SettingsManager::getCity() { return String(snapshot().city); }
 
-void SettingsManager::setCity(const String& city) {
-    String trimmed = city;
-    trimmed.trim();
-    if (trimmed.length() == 0) {
-        Serial.println("⚠️  [Settings] Leerer Stadtname ignoriert");
-        return;
+bool SettingsManager::setCity(const char* city) {
+    // Trimmen direkt in den Stack-Puffer
+    while (isspace((unsigned char)*city)) ++city;
+    size_t len = strlen(city);
+    while (len > 0 && isspace((unsigned char)city[len - 1])) --len;
+    if (len == 0) {
+        LOG_WARN(Settings, "Leerer Stadtname ignoriert");
+        return false;
     }
+
+    char buf[CITY_MAX_LEN] = {0};
+    len = min(len, (size_t)CITY_MAX_LEN - 1);
+    memcpy(buf, city, len);
+    buf[len] = '\0';
+
+    beginWrite();
     // Nur speichern, wenn sich etwas geändert hat
-    if (trimmed.equals(String(settings.city))) {
-        return;
+    bool changed = strcmp(buf, settings.city) != 0;
+    if (changed) {
+        memcpy(settings.city, buf, CITY_MAX_LEN);
+        markDirty(DIRTY_CITY);
     }
-
-    strncpy(settings.city, trimmed.c_str(), CITY_MAX_LEN - 1);
-    settings.city[CITY_MAX_LEN - 1] = '\0';
-    save();
-    Serial.printf("[Settings] Neue Stadt: %s\n", settings.city);
+    endWrite(changed);
+    if (changed) LOG_INFO(Settings, "Neue Stadt: %s", buf);
+    return changed;
 }
@@ -1,57 +1,274 @@
 #include "time_manager.h"
 #include "config.h"
-#include "display.h"
+#include "logger.h"
+#include <esp_sntp.h>
+#include <esp_timer.h>
+#include <Preferences.h>
 
 TimeManager timeManager;
 
-TimeManager::TimeManager() : synced(false), lastSync(0) {
+// NVS-Namespace für Zeit-Kalibrierung
+static const char *TIME_NVS_NS = "time";
+
+// Drift nur aus Syncs lernen, die weit genug auseinanderliegen und plausibel sind
+static const int64_t DRIFT_MIN_SPAN_US = 10LL * 60LL * 1000000LL;
+static const int64_t DRIFT_MAX_OFFSET_US = 1000000LL;
+
+// Sync-Intervall verdoppeln unter / halbieren über diesen Abweichungen
+static const int64_t SYNC_WIDEN_BELOW_US = 50000LL;
+static const int64_t SYNC_NARROW_ABOVE_US = 200000LL;
+
+// Gangkorrektur zwischen Syncs alle 60 s per adjtime nachführen
+static const int64_t DRIFT_CORR_PERIOD_US = 60LL * 1000000LL;
+
+// Alles vor 2020 gilt als "noch nicht synchronisiert"
+static const time_t MIN_VALID_EPOCH = 1577836800;
+
+// Timer leicht nach der Sekundengrenze auslösen, damit time() sicher die neue Sekunde liefert
+static const uint32_t SECOND_TICK_GUARD_US = 500;
+
+TimeManager::TimeManager()
+    : cachedEpoch(0), synced(false), lastSyncUs(-1), syncOffsetMs(0), syncCount(0),
+      secondTimer(nullptr), tickTask(nullptr), tickPending(false), frameSkewUs(0), maxFrameSkewUs(0),
+      driftPpb(0), syncIntervalMs(NTP_SYNC_INTERVAL_MS), calibrationDirty(false),
+      lastDriftCorrUs(0), driftCarryUs(0.0), estimated(false), lastEpochSaveUs(0) {
     memset(&timeinfo, 0, sizeof(timeinfo));
 }
 
 bool TimeManager::begin() {
-    Serial.println("Initialisiere Zeit-Synchronisation...");
-    
-    // Zeitzone konfigurieren
-    configTime(0, 0, NTP_SERVER);
-    setenv("TZ", TIMEZONE, 1);
-    tzset();
-    
-    return syncTime();
-}
-
-bool TimeManager::syncTime() {
-    display.drawText2x2("TIME");
-    Serial.print("Synchronisiere mit NTP-Server '" + String(NTP_SERVER) + "'...");
-    
-    int retry = 0;
-    while (!getLocalTime(&timeinfo) && retry < 15) {
-        Serial.print(".");
-        delay(500);
-        retry++;
-    }
-    
-    if (retry < 15) {
-        synced = true;
-        lastSync = millis();
-        Serial.println(" OK!");
-        Serial.printf("Zeit: %02d:%02d:%02d\n", 
-                     timeinfo.tm_hour, timeinfo.tm_min, timeinfo.tm_sec);
-        display.animateCheckmark();   
-        return true;
+    LOG_INFO(Time, "Initialisiere Zeit-Synchronisation (SNTP, nicht blockierend)...");
+
+    // Letzte Zeit + gelernte Drift übernehmen, falls NTP (noch) nicht erreichbar
+    restoreTime();
+
+    // Springen oder Nachführen entscheidet sntp_sync_time() unten
+    sntp_set_sync_interval(syncIntervalMs);
+
+    // Startet SNTP im Hintergrund und setzt die Zeitzone
+    configTzTime(TIMEZONE, NTP_SERVER);
+
+    return true;
+}
+
+// Ersetzt die schwache IDF-Implementierung: deren SMOOTH-Modus führt alles
+// unter ~35 min per adjtime nach, nach einem Kaltstart mit veralteter
+// NVS-Zeit ginge die Uhr dann stundenlang falsch
+extern "C" void sntp_sync_time(struct timeval *tv) {
+    timeManager.onTimeSync(tv);
+}
+
+// Läuft im lwIP-Task → nur Zustand setzen, keine Anzeige/Blockierung
+void TimeManager::onTimeSync(struct timeval *tv) {
+    struct timeval now;
+    gettimeofday(&now, nullptr);
+    int64_t deltaUs = (int64_t)(tv->tv_sec - now.tv_sec) * 1000000LL + (tv->tv_usec - now.tv_usec);
+    int64_t absDelta = deltaUs < 0 ? -deltaUs : deltaUs;
+
+    // Geschätzte Startzeit oder großer Fehler → springen, sonst sanft nachführen
+    bool step = estimated || absDelta > (int64_t)NTP_STEP_THRESHOLD_MS * 1000LL;
+    if (step) {
+        struct timeval none = {0, 0};
+        adjtime(&none, nullptr);    // laufende Korrektur verwerfen
+        settimeofday(tv, nullptr);
+        sntp_set_sync_status(SNTP_SYNC_STATUS_COMPLETED);
     } else {
-        synced = false;
-        Serial.println(" FEHLER!");
-        return false;
+        struct timeval slew = {(time_t)(deltaUs / 1000000LL), (suseconds_t)(deltaUs % 1000000LL)};
+        adjtime(&slew, nullptr);
+        sntp_set_sync_status(SNTP_SYNC_STATUS_IN_PROGRESS);
     }
+
+    int64_t nowUs = esp_timer_get_time();
+    // Geschätzte Zeit sagt nichts über den Quarz aus
+    if (!estimated) calibrate(deltaUs, nowUs);
+    else calibrationDirty = true;
+
+    estimated = false;
+    syncOffsetMs = (int32_t)(deltaUs / 1000);
+    lastSyncUs = nowUs;
+    syncCount = syncCount + 1;
+    synced = true;
+
+    LOG_INFO(Time, "SNTP-Sync #%u, Offset %d ms (%s), Drift %d ppb, Intervall %u s",
+             syncCount, syncOffsetMs, step ? "Sprung" : "Slew", driftPpb, syncIntervalMs / 1000);
+}
+
+// ------------------------------------------------------
+// Drift-Kalibrierung (lwIP-Task)
+// Zwischen zwei Syncs wird die bekannte Drift bereits per adjtime
+// ausgeglichen; der verbleibende Offset ist der Fehler der Schätzung.
+// ------------------------------------------------------
+void TimeManager::calibrate(int64_t offsetUs, int64_t nowUs) {
+    int64_t prev = lastSyncUs;
+    int64_t absOffset = offsetUs < 0 ? -offsetUs : offsetUs;
+
+    if (prev >= 0 && nowUs - prev >= DRIFT_MIN_SPAN_US && absOffset < DRIFT_MAX_OFFSET_US) {
+        // Server − lokal < 0 → lokale Uhr zu schnell → Drift positiv
+        int64_t residualPpb = -offsetUs * 1000000000LL / (nowUs - prev);
+        // Glätten (halbe Schrittweite), Messrauschen des Netzes dämpfen
+        driftPpb = driftPpb + (int32_t)(residualPpb / 2);
+
+        // Kleine Abweichung → seltener synchronisieren, große → öfter
+        uint32_t interval = syncIntervalMs;
+        if (absOffset < SYNC_WIDEN_BELOW_US && interval < NTP_SYNC_MAX_INTERVAL_MS) {
+            interval = min((uint32_t)(interval * 2), (uint32_t)NTP_SYNC_MAX_INTERVAL_MS);
+        } else if (absOffset > SYNC_NARROW_ABOVE_US && interval > NTP_SYNC_INTERVAL_MS) {
+            interval = max((uint32_t)(interval / 2), (uint32_t)NTP_SYNC_INTERVAL_MS);
+        }
+        if (interval != syncIntervalMs) {
+            syncIntervalMs = interval;
+            // gilt ab der nächsten Abfrage
+            sntp_set_sync_interval(interval);
+        }
+    }
+
+    // Schreiben in NVS erst im Loop-Task (update())
+    calibrationDirty = true;
+}
+
+// ------------------------------------------------------
+// Persistenz: Zeit (alle TIME_SAVE_INTERVAL_MS und bei Sync) + Drift + Intervall in NVS
+// ------------------------------------------------------
+void TimeManager::restoreTime() {
+    Preferences prefs;
+    prefs.begin(TIME_NVS_NS, true);
+    int64_t epoch = prefs.getLong64("epoch", 0);
+    driftPpb = prefs.getInt("drift", 0);
+    syncIntervalMs = constrain(prefs.getUInt("interval", NTP_SYNC_INTERVAL_MS),
+                               NTP_SYNC_INTERVAL_MS, NTP_SYNC_MAX_INTERVAL_MS);
+    prefs.end();
+
+    if (time(nullptr) >= MIN_VALID_EPOCH) {
+        // Software-Reset: Systemzeit läuft über den RTC-Timer weiter
+        LOG_INFO(Time, "Systemzeit nach Neustart übernommen, Drift %d ppb", driftPpb);
+    } else if (epoch >= MIN_VALID_EPOCH) {
+        // Kaltstart: letzte bekannte Zeit als Startwert, bis SNTP antwortet
+        struct timeval tv = {(time_t)epoch, 0};
+        settimeofday(&tv, nullptr);
+        estimated = true;
+        LOG_INFO(Time, "Letzte gesicherte Zeit aus NVS übernommen (bis SNTP antwortet), Drift %d ppb", driftPpb);
+    }
+    lastDriftCorrUs = esp_timer_get_time();
+    lastEpochSaveUs = lastDriftCorrUs;
+}
+
+void TimeManager::saveCalibration() {
+    calibrationDirty = false;
+    lastEpochSaveUs = esp_timer_get_time();
+
+    Preferences prefs;
+    if (!prefs.begin(TIME_NVS_NS, false)) return;
+    prefs.putLong64("epoch", (int64_t)time(nullptr));
+    prefs.putInt("drift", driftPpb);
+    prefs.putUInt("interval", syncIntervalMs);
+    prefs.end();
+}
+
+// Nur der Zeitstempel, damit ein Kaltstart nicht bis zu 12 h zurückfällt;
+// geschätzte Zeit wird nicht zurückgeschrieben
+void TimeManager::saveEpoch() {
+    int64_t nowUs = esp_timer_get_time();
+    if (nowUs - lastEpochSaveUs < (int64_t)TIME_SAVE_INTERVAL_MS * 1000LL) return;
+    lastEpochSaveUs = nowUs;
+    if (estimated || time(nullptr) < MIN_VALID_EPOCH) return;
+
+    Preferences prefs;
+    if (!prefs.begin(TIME_NVS_NS, false)) return;
+    prefs.putLong64("epoch", (int64_t)time(nullptr));
+    prefs.end();
+}
+
+// ------------------------------------------------------
+// Gelernte Drift zwischen den Syncs ausgleichen (Loop-Task)
+// ------------------------------------------------------
+void TimeManager::applyDriftCorrection() {
+    int64_t nowUs = esp_timer_get_time();
+    int64_t span = nowUs - lastDriftCorrUs;
+    if (span < DRIFT_CORR_PERIOD_US) return;
+    lastDriftCorrUs = nowUs;
+
+    int32_t drift = driftPpb;
+    if (drift == 0) return;
+
+    double corr = -(double)drift * (double)span / 1e9 + driftCarryUs;
+    int64_t whole = (int64_t)corr;
+    driftCarryUs = corr - (double)whole;
+    if (whole == 0) return;
+
+    // Laufende SNTP-Slew-Korrektur nicht verwerfen, sondern ergänzen
+    struct timeval pending;
+    adjtime(nullptr, &pending);
+    int64_t total = (int64_t)pending.tv_sec * 1000000LL + pending.tv_usec + whole;
+    struct timeval tv = {(time_t)(total / 1000000LL), (suseconds_t)(total % 1000000LL)};
+    adjtime(&tv, nullptr);
+}
+
+// ------------------------------------------------------
+// Sekundentakt (one-shot esp_timer, nach jedem Auslösen neu auf die
+// nächste Sekundengrenze der Systemzeit gestellt → driftet nicht, folgt
+// auch dem SNTP-Slew)
+// ------------------------------------------------------
+void TimeManager::startSecondTick(TaskHandle_t notifyTask) {
+    tickTask = notifyTask;
+    if (!secondTimer) {
+        esp_timer_create_args_t args = {};
+        args.callback = &TimeManager::onSecondTimer;
+        args.arg = this;
+        args.dispatch_method = ESP_TIMER_TASK;
+        args.name = "second_tick";
+        esp_timer_create(&args, &secondTimer);
+    }
+    armSecondTimer();
+}
+
+void TimeManager::armSecondTimer() {
+    struct timeval now;
+    gettimeofday(&now, nullptr);
+    uint64_t toNext = 1000000ULL - now.tv_usec + SECOND_TICK_GUARD_US;
+    esp_timer_start_once(secondTimer, toNext);
+}
+
+void TimeManager::onSecondTimer(void *arg) {
+    TimeManager *self = static_cast<TimeManager *>(arg);
+    self->tickPending = true;
+    if (self->tickTask) xTaskNotifyGive(self->tickTask);
+    self->armSecondTimer();
+}
+
+bool TimeManager::takeSecondTick() {
+    if (!tickPending) return false;
+    tickPending = false;
+    return true;
+}
+
+void TimeManager::markFrameLatched() {
+    struct timeval now;
+    gettimeofday(&now, nullptr);
+    frameSkewUs = (uint32_t)now.tv_usec;
+    if (frameSkewUs > maxFrameSkewUs) maxFrameSkewUs = frameSkewUs;
+}
+
+uint32_t TimeManager::getFrameSkewUs() {
+    return frameSkewUs;
+}
+
+uint32_t TimeManager::getMaxFrameSkewUs() {
+    return maxFrameSkewUs;
 }
 
 bool TimeManager::update() {
-    // Re-sync jede Stunde (Grund: Sommer/Winterzeit)
-    if (millis() - lastSync > 3600000) {
-        return syncTime();
+    if (calibrationDirty) saveCalibration();
+    else saveEpoch();
+    applyDriftCorrection();
+
+    time_t now = time(nullptr);
+    if (now < MIN_VALID_EPOCH) return false;
+
+    // Lokalzeit nur neu berechnen, wenn sich die Sekunde geändert hat
+    if (now != cachedEpoch) {
+        localtime_r(&now, &timeinfo);
+        cachedEpoch = now;
     }
-    
-    return getLocalTime(&timeinfo);
+    return true;
 }
 
 uint8_t TimeManager::getHour() {
@@ -82,6 +299,32 @@ bool TimeManager::isSynced() {
     return synced;
 }
 
+bool TimeManager::isValid() {
+    return cachedEpoch >= MIN_VALID_EPOCH;
+}
+
+int32_t TimeManager::getDriftPpb() {
+    return driftPpb;
+}
+
+uint32_t TimeManager::getSyncIntervalMs() {
+    return syncIntervalMs;
+}
+
+int32_t TimeManager::getSyncOffsetMs() {
+    return syncOffsetMs;
+}
+
+uint32_t TimeManager::getSecondsSinceSync() {
+    int64_t last = lastSyncUs;
+    if (last < 0) return UINT32_MAX;
+    return (uint32_t)((esp_timer_get_time() - last) / 1000000LL);
+}
+
+uint32_t TimeManager::getSyncCount() {
+    return syncCount;
+}
+
 String TimeManager::getTimeString() {
     char buffer[9];
     snprintf(buffer, sizeof(buffer), "%02d:%02d:%02d", 
@@ -1,7 +1,10 @@
 #include "weather_manager.h"
 #include "wifi_manager.h"
-#include <WiFiClientSecure.h>
+#include "weather_provider.h"
 #include "display.h"
+#include "metrics.h"
+#include "logger.h"
+#include "diagnostics.h"
 
 WeatherManager weatherManager;
 
@@ -22,17 +25,10 @@ String WeatherManager::getCity() const {
     return city;
 }
 
-static String mapCondition(const String& raw) {
-    String r = raw;
-    r.toLowerCase();
-
-    if (r.indexOf("regen") >= 0 || r.indexOf("rain") >= 0) return "Rain";
-    if (r.indexOf("bewölkt") >= 0 || r.indexOf("bedeckt") >= 0 || r.indexOf("cloud") >= 0) return "Cloud";
-    if (r.indexOf("sonnig") >= 0 || r.indexOf("klar") >= 0 || r.indexOf("clear") >= 0) return "Clear";
-    if (r.indexOf("nebel") >= 0 || r.indexOf("fog") >= 0) return "Fog";
-    if (r.indexOf("schnee") >= 0 || r.indexOf("snow") >= 0) return "Snow";
-    if (r.indexOf("gewitter") >= 0 || r.indexOf("thunder") >= 0) return "Thunder";
-    return "Unknown";
+const char* weatherConditionName(WeatherCondition cond) {
+    static const char* const names[] = {"Unknown", "Clear", "Cloud", "Rain", "Snow", "Thunder", "Fog"};
+    uint8_t i = (uint8_t)cond;
+    return i < (uint8_t)WeatherCondition::COUNT ? names[i] : names[0];
 }
 
 void WeatherManager::update(const bool withoutCheckmark) {
@@ -44,60 +40,124 @@ void WeatherManager::update(const bool withoutCheckmark) {
 
     display.drawText2x2("WTTR");
 
-    String url = "https://wttr.in/" + city + "?format=j1";
-    Serial.println("[Weather] Lade: " + url);
-
-    WiFiClientSecure client;
-    client.setInsecure();  // kein Zertifikat prüfen
+    if (!provider) provider = &defaultWeatherProvider();
+    if (!provider->resolve(city)) return;
+
+    WeatherReport report;
+    unsigned long started = millis();
+    bool ok = weatherHttpGet(provider->buildUrl(city), [this, &report](Stream& body) {
+        return provider->parse(body, report);
+    });
+    metrics.observeFetch(FetchSource::Weather, millis() - started, ok);
+    diagnostics.recordFetch(FetchSource::Weather, millis() - started, ok);
+    if (!ok) return;
+
+    temperature = report.temperature;
+    condition = report.condition;
+    // Lokal vorberechnen, dann in einem Stück veröffentlichen
+    ForecastColumns built;
+    buildForecastColumns(report.forecast, built);
+    portENTER_CRITICAL(&forecastMux);
+    columns = built;
+    portEXIT_CRITICAL(&forecastMux);
+
+    LOG_INFO(Weather, "%s: %.1f°C, %s, Vorhersage %d Slots (%d..%d°C)",
+             provider->name(), temperature, weatherConditionName(condition),
+             built.slots, built.min, built.max);
+    if (!withoutCheckmark) {
+        display.animateCheckmark();
+    }
+}
 
-    HTTPClient http;
-    if (!http.begin(client, url)) {
-        Serial.println("[Weather] HTTP begin() fehlgeschlagen");
-        return;
+bool WeatherManager::updateAsync(const bool withoutCheckmark) {
+    bool expected = false;
+    if (!updating.compare_exchange_strong(expected, true)) return false;
+    asyncWithoutCheckmark = withoutCheckmark;
+
+    BaseType_t ok = xTaskCreatePinnedToCore([](void *arg) {
+        WeatherManager *self = static_cast<WeatherManager *>(arg);
+        self->update(self->asyncWithoutCheckmark);
+        metrics.recordTaskStack("WeatherUpdateTask", uxTaskGetStackHighWaterMark(NULL));
+        self->updating.store(false);
+        vTaskDelete(NULL); }, "WeatherUpdateTask", 8192, this, 1, NULL, 1);
+
+    if (ok != pdPASS) {
+        LOG_ERROR(Weather, "Task konnte nicht gestartet werden");
+        updating.store(false);
+        return false;
     }
+    return true;
+}
+
+void WeatherManager::setProvider(WeatherProvider& p) {
+    provider = &p;
+    // Erzwinge ein Update beim nächsten Aufruf
+    lastUpdate = 0;
+}
 
-    int code = http.GET();
-    if (code != 200) {
-        Serial.printf("[Weather] HTTP Fehler: %d\n", code);
-        http.end();
-        return;
+// ------------------------------------------------------
+// Sparkline + Regenbalken als Spalten-Bitmasken vorberechnen,
+// damit die Anzeige pro Frame nur noch kopieren muss
+// ------------------------------------------------------
+void WeatherManager::buildForecastColumns(const ForecastBuffer& forecast, ForecastColumns& out) {
+    out = {};
+    uint8_t n = forecast.size();
+    out.slots = n;
+    if (n == 0) return;
+
+    int8_t lo = forecast.at(0).temp, hi = lo;
+    for (uint8_t i = 1; i < n; ++i) {
+        lo = min(lo, forecast.at(i).temp);
+        hi = max(hi, forecast.at(i).temp);
     }
+    out.min = lo;
+    out.max = hi;
+
+    int span = max(hi - lo, 1);
+    int prevY = -1;
+    for (uint8_t x = 0; x < n; ++x) {
+        // Zeile 15 = Minimum, Zeile 0 = Maximum
+        int y = 15 - ((forecast.at(x).temp - lo) * 15 + span / 2) / span;
+        // Sprünge zum Vorgänger vertikal verbinden
+        int top = y, bottom = y;
+        if (prevY >= 0 && prevY < y) top = prevY + 1;
+        if (prevY > y) bottom = prevY - 1;
+        for (int r = top; r <= bottom; ++r) out.sparkline[x] |= (1u << r);
+        prevY = y;
+
+        uint8_t height = (forecast.at(x).precip * 16 + 50) / 100;
+        for (uint8_t r = 0; r < height; ++r) out.precipBars[x] |= (1u << (15 - r));
+    }
+}
 
-    String payload = http.getString();
-    http.end();
+bool WeatherManager::hasForecast() const {
+    portENTER_CRITICAL(&forecastMux);
+    bool any = columns.slots > 0;
+    portEXIT_CRITICAL(&forecastMux);
+    return any;
+}
 
-    // JSON kann sehr groß sein → größeren Buffer
-    JsonDocument doc;
-    DeserializationError err = deserializeJson(doc, payload);
+bool WeatherManager::copyForecastColumns(uint16_t* out, bool precip) const {
+    portENTER_CRITICAL(&forecastMux);
+    bool any = columns.slots > 0;
+    memcpy(out, precip ? columns.precipBars : columns.sparkline, sizeof(columns.sparkline));
+    portEXIT_CRITICAL(&forecastMux);
+    return any;
+}
 
-    if (err) {
-        Serial.println("[Weather] JSON Parse Error: " + String(err.c_str()));
-        return;
-    }
+int8_t WeatherManager::getForecastMin() const {
+    portENTER_CRITICAL(&forecastMux);
+    int8_t v = columns.min;
+    portEXIT_CRITICAL(&forecastMux);
+    return v;
+}
 
-    JsonObject current = doc["current_condition"][0];
-    if (!current.isNull()) {
-        const char* t = current["temp_C"];
-        const char* desc = nullptr;
-
-        // bevorzugt deutsche Beschreibung, sonst englische
-        if (current["lang_de"][0]["value"]) {
-            desc = current["lang_de"][0]["value"];
-        } else if (current["weatherDesc"][0]["value"]) {
-            desc = current["weatherDesc"][0]["value"];
-        }
-
-        if (t) temperature = atof(t);
-        if (desc) condition = mapCondition(String(desc));
-
-        Serial.printf("[Weather] %.1f°C, %s\n", temperature, condition.c_str());
-        if (!withoutCheckmark) {
-            display.animateCheckmark();
-        }
-    } else {
-        Serial.println("[Weather] Kein gültiger current_condition-Block gefunden");
-    }
+int8_t WeatherManager::getForecastMax() const {
+    portENTER_CRITICAL(&forecastMux);
+    int8_t v = columns.max;
+    portEXIT_CRITICAL(&forecastMux);
+    return v;
 }
 
 float WeatherManager::getTemperature() const { return temperature; }
-String WeatherManager::getCondition() const { return condition; }
+WeatherCondition WeatherManager::getCondition() const { return condition; }
@@ -0,0 +1,256 @@
+#include "weather_provider.h"
+#include "config.h"
+#include "time_manager.h"
+#include <HTTPClient.h>
+#include <WiFiClient.h>
+#include "https_pool.h"
+#include "logger.h"
+
+static WttrJsonProvider wttrProvider;
+static OpenMeteoProvider openMeteoProvider;
+
+WeatherProvider& defaultWeatherProvider() {
+#ifdef WEATHER_PROVIDER_OPEN_METEO
+    return openMeteoProvider;
+#else
+    return wttrProvider;
+#endif
+}
+
+// ------------------------------------------------------
+// Hilfsfunktionen
+// ------------------------------------------------------
+static String urlEncode(const String& s) {
+    static const char hex[] = "0123456789ABCDEF";
+    String out;
+    out.reserve(s.length() * 3);
+    for (size_t i = 0; i < s.length(); ++i) {
+        uint8_t c = (uint8_t)s[i];
+        if (isalnum(c) || c == '-' || c == '_' || c == '.' || c == '~') {
+            out += (char)c;
+        } else {
+            out += '%';
+            out += hex[c >> 4];
+            out += hex[c & 0x0F];
+        }
+    }
+    return out;
+}
+
+bool weatherHttpGet(const String& url, std::function<bool(Stream&)> parse) {
+    LOG_DEBUG(Weather, "Lade: %s", url);
+
+    WiFiClient plainClient;
+    WiFiClientSecure* secureClient = nullptr;
+    if (url.startsWith("https://")) {
+        secureClient = httpsPool.acquire(url);
+        if (!secureClient) return false;
+    }
+
+    HTTPClient http;
+    // HTTP/1.0 → kein Chunked-Encoding, Body kann direkt gestreamt werden
+    http.useHTTP10(true);
+    if (!http.begin(secureClient ? (WiFiClient&)*secureClient : plainClient, url)) {
+        LOG_ERROR(Weather, "HTTP begin() fehlgeschlagen");
+        httpsPool.release(secureClient, false);
+        return false;
+    }
+
+    int code = http.GET();
+    if (code != 200) {
+        LOG_WARN(Weather, "HTTP Fehler: %d", code);
+        http.end();
+        httpsPool.release(secureClient, false);
+        return false;
+    }
+
+    bool ok = parse(http.getStream());
+    http.end();
+    // HTTP/1.0: Server schließt nach der Antwort, Abrufe liegen ohnehin
+    // weiter auseinander als HTTPS_IDLE_TIMEOUT_MS → nichts zu behalten
+    httpsPool.release(secureClient, false);
+    return ok;
+}
+
+// ======================================================
+// wttr.in (format=j1)
+// ======================================================
+String WttrJsonProvider::buildUrl(const String& city) const {
+    return String(WTTR_BASE_URL) + "/" + urlEncode(city) + "?format=j1";
+}
+
+bool WttrJsonProvider::parse(Stream& body, WeatherReport& out) {
+    // j1 ist sehr groß → nur benötigte Felder behalten
+    JsonDocument filter;
+    filter["current_condition"][0]["temp_C"] = true;
+    filter["current_condition"][0]["weatherCode"] = true;
+    JsonObject fh = filter["weather"][0]["hourly"][0].to<JsonObject>();
+    fh["time"] = true;
+    fh["tempC"] = true;
+    fh["chanceofrain"] = true;
+    fh["weatherCode"] = true;
+
+    JsonDocument doc;
+    DeserializationError err = deserializeJson(doc, body, DeserializationOption::Filter(filter));
+    if (err) {
+        LOG_ERROR(Weather, "JSON Parse Error: %s", err.c_str());
+        return false;
+    }
+
+    JsonObject current = doc["current_condition"][0];
+    if (current.isNull()) {
+        LOG_WARN(Weather, "Kein gültiger current_condition-Block gefunden");
+        return false;
+    }
+    out.temperature = atof(current["temp_C"] | "0");
+    out.condition = mapCode((uint16_t)atoi(current["weatherCode"] | "0"));
+
+    // Vorhersage: weather[].hourly[] ab aktuellem 3h-Slot
+    // wttr.in liefert "0", "300", ..., "2100"
+    out.forecast.clear();
+    int nowHHMM = (timeManager.getHour() / 3) * 300;
+    bool firstDay = true;
+
+    for (JsonObject day : doc["weather"].as<JsonArray>()) {
+        for (JsonObject h : day["hourly"].as<JsonArray>()) {
+            if (firstDay && atoi(h["time"] | "0") < nowHHMM) continue;
+
+            HourlyForecast f;
+            f.temp = (int8_t)constrain(atoi(h["tempC"] | "0"), -128, 127);
+            f.precip = (uint8_t)constrain(atoi(h["chanceofrain"] | "0"), 0, 100);
+            f.condition = mapCode((uint16_t)atoi(h["weatherCode"] | "0"));
+            out.forecast.push(f);
+
+            if (out.forecast.full()) break;
+        }
+        firstDay = false;
+        if (out.forecast.full()) break;
+    }
+    return true;
+}
+
+// WWO-Wettercode (z. B. 113 = klar)
+WeatherCondition WttrJsonProvider::mapCode(uint16_t code) const {
+    switch (code) {
+    case 113:
+        return WeatherCondition::Clear;
+    case 116: case 119: case 122:
+        return WeatherCondition::Cloud;
+    case 143: case 248: case 260:
+        return WeatherCondition::Fog;
+    case 200: case 386: case 389: case 392: case 395:
+        return WeatherCondition::Thunder;
+    case 176: case 263: case 266: case 281: case 284:
+    case 293: case 296: case 299: case 302: case 305: case 308:
+    case 311: case 314: case 353: case 356: case 359:
+        return WeatherCondition::Rain;
+    case 179: case 182: case 185: case 227: case 230:
+    case 317: case 320: case 323: case 326: case 329: case 332:
+    case 335: case 338: case 350: case 362: case 365: case 368:
+    case 371: case 374: case 377:
+        return WeatherCondition::Snow;
+    default:
+        return WeatherCondition::Unknown;
+    }
+}
+
+// ======================================================
+// Open-Meteo (current + hourly, ~1 KB)
+// ======================================================
+bool OpenMeteoProvider::resolve(const String& city) {
+    if (city == resolvedCity) return true;
+
+    String url = String(OPEN_METEO_GEO_URL) + "/v1/search?count=1&format=json&name=" + urlEncode(city);
+    bool ok = weatherHttpGet(url, [this](Stream& body) {
+        JsonDocument filter;
+        filter["results"][0]["latitude"] = true;
+        filter["results"][0]["longitude"] = true;
+
+        JsonDocument doc;
+        if (deserializeJson(doc, body, DeserializationOption::Filter(filter))) return false;
+        JsonObject r = doc["results"][0];
+        if (r.isNull()) return false;
+        latitude = r["latitude"] | 0.0f;
+        longitude = r["longitude"] | 0.0f;
+        return true;
+    });
+
+    if (!ok) {
+        LOG_WARN(Weather, "Stadt nicht gefunden: %s", city);
+        return false;
+    }
+    resolvedCity = city;
+    LOG_INFO(Weather, "%s → %.4f, %.4f", city.c_str(), latitude, longitude);
+    return true;
+}
+
+String OpenMeteoProvider::buildUrl(const String&) const {
+    char url[256];
+    snprintf(url, sizeof(url),
+             "%s/v1/forecast?latitude=%.4f&longitude=%.4f"
+             "&current=temperature_2m,weather_code"
+             "&hourly=temperature_2m,precipitation_probability,weather_code"
+             "&forecast_hours=%d&timeformat=unixtime",
+             OPEN_METEO_BASE_URL, latitude, longitude, FORECAST_SLOTS * 3);
+    return String(url);
+}
+
+bool OpenMeteoProvider::parse(Stream& body, WeatherReport& out) {
+    JsonDocument filter;
+    filter["current"]["temperature_2m"] = true;
+    filter["current"]["weather_code"] = true;
+    filter["hourly"]["temperature_2m"] = true;
+    filter["hourly"]["precipitation_probability"] = true;
+    filter["hourly"]["weather_code"] = true;
+
+    JsonDocument doc;
+    DeserializationError err = deserializeJson(doc, body, DeserializationOption::Filter(filter));
+    if (err) {
+        LOG_ERROR(Weather, "JSON Parse Error: %s", err.c_str());
+        return false;
+    }
+
+    JsonObject current = doc["current"];
+    if (current.isNull()) {
+        LOG_WARN(Weather, "Kein gültiger current-Block gefunden");
+        return false;
+    }
+    out.temperature = current["temperature_2m"] | 0.0f;
+    out.condition = mapCode(current["weather_code"] | 0);
+
+    // Stündliche Werte auf das 3h-Raster der Anzeige ausdünnen
+    JsonArray temps = doc["hourly"]["temperature_2m"];
+    JsonArray precip = doc["hourly"]["precipitation_probability"];
+    JsonArray codes = doc["hourly"]["weather_code"];
+    out.forecast.clear();
+    for (size_t i = 0; i < temps.size() && !out.forecast.full(); i += 3) {
+        HourlyForecast f;
+        f.temp = (int8_t)constrain(lroundf(temps[i] | 0.0f), -128, 127);
+        f.precip = (uint8_t)constrain(precip[i] | 0, 0, 100);
+        f.condition = mapCode(codes[i] | 0);
+        out.forecast.push(f);
+    }
+    return true;
+}
+
+// WMO-Wettercode (0 = klar, 61 = Regen, ...)
+WeatherCondition OpenMeteoProvider::mapCode(uint16_t code) const {
+    switch (code) {
+    case 0: case 1:
+        return WeatherCondition::Clear;
+    case 2: case 3:
+        return WeatherCondition::Cloud;
+    case 45: case 48:
+        return WeatherCondition::Fog;
+    case 51: case 53: case 55: case 56: case 57:
+    case 61: case 63: case 65: case 66: case 67:
+    case 80: case 81: case 82:
+        return WeatherCondition::Rain;
+    case 71: case 73: case 75: case 77: case 85: case 86:
+        return WeatherCondition::Snow;
+    case 95: case 96: case 99:
+        return WeatherCondition::Thunder;
+    default:
+        return WeatherCondition::Unknown;
+    }
+}
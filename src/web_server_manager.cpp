@@ -4,533 +4,614 @@
 #include "wifi_manager.h"
 #include "time_manager.h"
 #include "settings_manager.h"
-#include <HTTPClient.h>
-#include <HTTPUpdate.h>
-#include <WiFiClient.h>
-#include "version.h"
+#include <AsyncJson.h>
+#include <LittleFS.h>
+#include <algorithm>
 #include "weather_manager.h"
-#include <ArduinoJson.h>
+#include "web_ui.h"
+#include "json_writer.h"
+#include "pixel_receiver.h"
+#include "display_mirror.h"
+#include "ota_service.h"
+#include "metrics.h"
+#include "metric_history.h"
+#include "logger.h"
+#include "profiler.h"
+#include "diagnostics.h"
+#include "heap_probe.h"
 
 WebServerManager webServer;
 
-WebServerManager::WebServerManager() : server(WEB_SERVER_PORT) {}
+WebServerManager::WebServerManager() : server(WEB_SERVER_PORT), ws("/ws") {}
+
+// ETag der Startseite aus dem Dateisystem (Asset-Stand)
+static const char FS_INDEX_ETAG[] = "\"" WEB_ASSETS_ID "\"";
+
+// LittleFS nur verwenden, wenn das Image zum Asset-Stand dieser Firmware passt
+// (OTA aktualisiert nur die App-Partition, nicht das Dateisystem)
+static bool mountAssets() {
+    if (!LittleFS.begin(false)) {
+        LOG_WARN(Web, "Kein LittleFS-Image → eingebettete Seite");
+        return false;
+    }
+    File id = LittleFS.open("/assets.id", "r");
+    String fsId = id ? id.readString() : String();
+    if (id) id.close();
+    fsId.trim();
+    if (fsId != WEB_ASSETS_ID) {
+        LOG_WARN(Web, "LittleFS-Assets veraltet (%s ≠ %s) → eingebettete Seite", fsId.c_str(), WEB_ASSETS_ID);
+        return false;
+    }
+    LOG_INFO(Web, "Assets aus LittleFS (%s)", WEB_ASSETS_ID);
+    return true;
+}
 
 void WebServerManager::begin() {
-    server.on("/", [this]() { handleRoot(); });
-    server.on("/api/settings", HTTP_GET, [this]() { handleGetSettings(); });
-    server.on("/api/settings", HTTP_POST, [this]() { handleSaveSettings(); });
-    server.on("/api/restart", HTTP_POST, [this]() { handleRestart(); });
-    server.on("/api/reset", HTTP_POST, [this]() { handleReset(); });
-    server.on("/api/status", HTTP_GET, [this]() { handleStatus(); });
-    server.on("/api/update", HTTP_POST, [this]() { handleOTAUpdate(); });
-    server.onNotFound([this]() { handleNotFound(); });
-    
+    fsAssets = mountAssets();
+    if (fsAssets) {
+        // Dateinamen enthalten den Inhalts-Hash → dürfen ewig gecacht werden
+        server.serveStatic("/assets/", LittleFS, "/assets/")
+            .setCacheControl("public, max-age=31536000, immutable");
+    }
+
+    server.on("/", HTTP_GET, [this](AsyncWebServerRequest *r) { handleRoot(r); });
+    server.on("/api/settings", HTTP_GET, [this](AsyncWebServerRequest *r) { handleGetSettings(r); });
+    server.on("/api/restart", HTTP_POST, [this](AsyncWebServerRequest *r) { handleRestart(r); });
+    server.on("/api/reset", HTTP_POST, [this](AsyncWebServerRequest *r) { handleReset(r); });
+    server.on("/api/status", HTTP_GET, [this](AsyncWebServerRequest *r) { handleStatus(r); });
+    server.on("/api/update", HTTP_POST, [this](AsyncWebServerRequest *r) { handleOTAUpdate(r); });
+    server.on("/api/update/status", HTTP_GET, [this](AsyncWebServerRequest *r) { handleOTAStatus(r); });
+    server.on("/metrics", HTTP_GET, [this](AsyncWebServerRequest *r) { handleMetrics(r); });
+    server.on("/api/history", HTTP_GET, [this](AsyncWebServerRequest *r) { handleHistory(r); });
+    server.on("/api/logs", HTTP_GET, [this](AsyncWebServerRequest *r) { handleLogs(r); });
+    server.on("/api/profile", HTTP_GET, [this](AsyncWebServerRequest *r) { handleProfile(r); });
+    server.on("/api/diagnostics", HTTP_GET, [this](AsyncWebServerRequest *r) { handleDiagnostics(r); });
+
+    // JSON-Body wird vom Handler gepuffert und geparst
+    AsyncCallbackJsonWebHandler *saveHandler = new AsyncCallbackJsonWebHandler(
+        "/api/settings", [this](AsyncWebServerRequest *r, JsonVariant &json) { handleSaveSettings(r, json); });
+    saveHandler->setMethod(HTTP_POST);
+    server.addHandler(saveHandler);
+
+    AsyncCallbackJsonWebHandler *logLevelHandler = new AsyncCallbackJsonWebHandler(
+        "/api/logs/level", [this](AsyncWebServerRequest *r, JsonVariant &json) { handleLogLevel(r, json); });
+    logLevelHandler->setMethod(HTTP_POST);
+    server.addHandler(logLevelHandler);
+
+    // Live-Status: ersetzt das 1-s-Polling von /api/status
+    ws.onEvent([this](AsyncWebSocket *socket, AsyncWebSocketClient *client, AwsEventType type,
+                      void *, uint8_t *, size_t) { onWsEvent(socket, client, type); });
+    server.addHandler(&ws);
+    displayMirror.begin(server);
+
+    server.onNotFound([this](AsyncWebServerRequest *r) { handleNotFound(r); });
+
     server.begin();
-    Serial.println("Webserver gestartet auf Port " + String(WEB_SERVER_PORT));
+    LOG_INFO(Web, "Webserver gestartet auf Port %d", WEB_SERVER_PORT);
 }
 
-void WebServerManager::handleClient() {
-    server.handleClient();
+// ------------------------------------------------------
+// Vorgemerkte Aktionen (Haupt-Task)
+// ------------------------------------------------------
+void WebServerManager::schedule(PendingAction action) {
+    // Kurz warten, damit die Antwort noch vollständig rausgeht
+    if (action != ACTION_WEATHER) actionDueAt = millis() + 1000;
+    pending.fetch_or(action);
 }
 
-String WebServerManager::getHTML() {
-    String html = R"rawliteral(
-<!DOCTYPE html>
-<html lang="de">
-<head>
-    <meta charset="UTF-8">
-    <meta name="viewport" content="width=device-width, initial-scale=1.0">
-    <title>OBEGRÄNSAD-X Konfiguration</title>
-    <style>
-        * { margin: 0; padding: 0; box-sizing: border-box; }
-        body {
-            font-family: -apple-system, BlinkMacSystemFont, 'Segoe UI', Roboto, sans-serif;
-            background: linear-gradient(135deg, #667eea 0%, #764ba2 100%);
-            min-height: 100vh;
-            display: flex;
-            justify-content: center;
-            align-items: center;
-            padding: 20px;
-        }
-        .container {
-            background: white;
-            border-radius: 20px;
-            box-shadow: 0 20px 60px rgba(0,0,0,0.3);
-            max-width: 500px;
-            width: 100%;
-            padding: 40px;
-        }
-        h1 {
-            color: #333;
-            margin-bottom: 10px;
-            font-size: 28px;
-        }
-        .subtitle {
-            color: #666;
-            margin-bottom: 30px;
-            font-size: 14px;
-        }
-        .info-grid {
-            display: grid;
-            grid-template-columns: 1fr 1fr;
-            gap: 15px;
-            margin-bottom: 25px;
-        }
-        .info-card {
-            background: #f0f4ff;
-            border-left: 4px solid #667eea;
-            padding: 15px;
-            border-radius: 8px;
-        }
-        .info-card strong {
-            color: #667eea;
-            display: block;
-            margin-bottom: 5px;
-            font-size: 12px;
-        }
-        .info-card span {
-            color: #333;
-            font-size: 16px;
-            font-weight: 600;
-        }
-        .live-indicator {
-            display: inline-block;
-            width: 8px;
-            height: 8px;
-            background: #28a745;
-            border-radius: 50%;
-            margin-right: 5px;
-            animation: pulse 2s infinite;
-        }
-        @keyframes pulse {
-            0%, 100% { opacity: 1; }
-            50% { opacity: 0.5; }
-        }
-        .form-group {
-            margin-bottom: 25px;
-        }
-        label {
-            display: block;
-            margin-bottom: 8px;
-            color: #333;
-            font-weight: 600;
-            font-size: 14px;
-        }
-        input[type="range"] {
-            width: 100%;
-            height: 8px;
-            border-radius: 5px;
-            background: #ddd;
-            outline: none;
-            -webkit-appearance: none;
-        }
-        input[type="range"]::-webkit-slider-thumb {
-            -webkit-appearance: none;
-            width: 20px;
-            height: 20px;
-            border-radius: 50%;
-            background: #667eea;
-            cursor: pointer;
-        }
-        input[type="range"]::-moz-range-thumb {
-            width: 20px;
-            height: 20px;
-            border-radius: 50%;
-            background: #667eea;
-            cursor: pointer;
-            border: none;
-        }
-        .value-display {
-            text-align: center;
-            font-size: 24px;
-            font-weight: bold;
-            color: #667eea;
-            margin-top: 10px;
-        }
-        select, input[type="text"] {
-            width: 100%;
-            padding: 12px;
-            border: 2px solid #ddd;
-            border-radius: 8px;
-            font-size: 16px;
-            background: white;
-            cursor: pointer;
-        }
-        select:focus, input[type="text"]:focus {
-            outline: none;
-            border-color: #667eea;
-        }
-        .button-group {
-            display: grid;
-            grid-template-columns: 1fr 1fr;
-            gap: 10px;
-            margin-top: 30px;
-        }
-        button {
-            padding: 15px;
-            border: none;
-            border-radius: 8px;
-            font-size: 14px;
-            font-weight: 600;
-            cursor: pointer;
-            transition: all 0.3s;
-        }
-        .btn-primary {
-            background: #667eea;
-            color: white;
-        }
-        .btn-primary:hover {
-            background: #5568d3;
-            transform: translateY(-2px);
-        }
-        .btn-secondary {
-            background: #e0e0e0;
-            color: #333;
-        }
-        .btn-secondary:hover {
-            background: #d0d0d0;
-        }
-        .btn-danger {
-            background: #dc3545;
-            color: white;
-        }
-        .btn-danger:hover {
-            background: #c82333;
-        }
-        .status {
-            margin-top: 20px;
-            padding: 15px;
-            border-radius: 8px;
-            text-align: center;
-            font-weight: 600;
-            display: none;
-        }
-        .status.success {
-            background: #d4edda;
-            color: #155724;
-            display: block;
-        }
-        .status.error {
-            background: #f8d7da;
-            color: #721c24;
-            display: block;
-        }
-    </style>
-</head>
-<body>
-    <div class="container">
-        <h1>OBEGRÄNSAD-X</h1>
-        <p class="subtitle">Konfiguration</p>
-        
-        <div class="info-grid">
-            <div class="info-card">
-                <strong>WLAN</strong>
-                <span id="ssid">)rawliteral" + wifiConnection.getSSID() + R"rawliteral(</span>
-            </div>
-            <div class="info-card">
-                <strong>IP-Adresse</strong>
-                <span id="ip">)rawliteral" + wifiConnection.getIP() + R"rawliteral(</span>
-            </div>
-            <div class="info-card">
-                <strong>Signal</strong>
-                <span id="rssi">)rawliteral" + String(wifiConnection.getRSSI()) + R"rawliteral( dBm</span>
-            </div>
-            <div class="info-card">
-                <strong><span class="live-indicator"></span>Zeit</strong>
-                <span id="time">)rawliteral" + timeManager.getTimeString() + R"rawliteral(</span>
-            </div>
-        </div>
-        
-        <form id="settingsForm">
-            <div class="form-group">
-                <label for="brightness">Helligkeit</label>
-                <input type="range" id="brightness" name="brightness" min="10" max="255" value=")rawliteral" + String(settingsManager.getBrightness()) + R"rawliteral(" oninput="updateValue(this.value)">
-                <div class="value-display" id="brightnessValue">)rawliteral" + String(settingsManager.getBrightness()) + R"rawliteral(</div>
-            </div>
-            
-            <div class="form-group">
-                <label for="mode">Anzeigemodus</label>
-                <select id="mode" name="mode">
-                    <option value="0" )rawliteral" + String(settingsManager.getDisplayMode() == 0 ? "selected" : "") + R"rawliteral(>Uhrzeit (HH:MM)</option>
-                    <option value="1" )rawliteral" + String(settingsManager.getDisplayMode() == 1 ? "selected" : "") + R"rawliteral(>Sekunden</option>
-                    <option value="2" )rawliteral" + String(settingsManager.getDisplayMode() == 2 ? "selected" : "") + R"rawliteral(>Datum (TT.MM)</option>
-                    <option value="3" )rawliteral" + String(settingsManager.getDisplayMode() == 3 ? "selected" : "") + R"rawliteral(>Wetter</option>
-                    <option value="4" )rawliteral" + String(settingsManager.getDisplayMode() == 4 ? "selected" : "") + R"rawliteral(>Automatikmodus Uhrzeit/Sekunden</option>
-                    <option value="5" )rawliteral" + String(settingsManager.getDisplayMode() == 5 ? "selected" : "") + R"rawliteral(>Game of Life</option>
-                    <option value="6" )rawliteral" + String(settingsManager.getDisplayMode() == 6 ? "selected" : "") + R"rawliteral(>Pong</option>
-                    <option value="7" )rawliteral" + String(settingsManager.getDisplayMode() == 7 ? "selected" : "") + R"rawliteral(>WiFi Signal (WIP)</option>
-                    <option value="8" )rawliteral" + String(settingsManager.getDisplayMode() == 8 ? "selected" : "") + R"rawliteral(>Matrix Rain (WIP)</option>
-                    <option value="9" )rawliteral" + String(settingsManager.getDisplayMode() == 9 ? "selected" : "") + R"rawliteral(>Display aus</option>
-                </select>
-            </div>
-
-            <div class="form-group">
-                <label for="city">Wetter · Stadt</label>
-                <input type="text" id="city" name="city" placeholder="z. B. Berlin" value=")rawliteral" + settingsManager.getCity() + R"rawliteral(" />
-            </div>
-            
-            <div class="button-group">
-                <button type="submit" class="btn-primary">Speichern</button>
-                <button type="button" class="btn-secondary" onclick="restart()">Neustart</button>
-                <button type="button" class="btn-secondary" onclick="firmwareUpdate()">Firmware-Update</button>
-                <button type="button" class="btn-danger" onclick="resetWiFi()">WiFi Reset</button>
-            </div>
-        </form>
-        
-        <div id="status" class="status"></div>
-    </div>
-    
-    <script>
-        setInterval(async () => {
-            try {
-                const response = await fetch('/api/status');
-                const data = await response.json();
-                document.getElementById('time').textContent = data.time;
-                document.getElementById('rssi').textContent = data.rssi + ' dBm';
-            } catch (error) {
-                console.error('Status update failed:', error);
-            }
-        }, 1000);
-        
-        function updateValue(val) {
-            document.getElementById('brightnessValue').textContent = val;
-        }
-        
-        document.getElementById('settingsForm').addEventListener('submit', async (e) => {
-            e.preventDefault();
-            const data = {
-                brightness: parseInt(document.getElementById('brightness').value),
-                mode: parseInt(document.getElementById('mode').value),
-                city: (document.getElementById('city').value || '').trim()
-            };
-            
-            try {
-                const response = await fetch('/api/settings', {
-                    method: 'POST',
-                    headers: { 'Content-Type': 'application/json' },
-                    body: JSON.stringify(data)
-                });
-                if (response.ok) {
-                    showStatus('Einstellungen gespeichert!', 'success');
-                } else {
-                    showStatus('Fehler beim Speichern!', 'error');
-                }
-            } catch (error) {
-                showStatus('Fehler beim Speichern!', 'error');
-            }
-        });
-        
-        async function restart() {
-            if (confirm('Gerät neu starten?')) {
-                await fetch('/api/restart', { method: 'POST' });
-                showStatus('Neustart...', 'success');
-            }
-        }
-        
-        async function resetWiFi() {
-            if (confirm('WiFi-Einstellungen zurücksetzen? Das Gerät startet neu.')) {
-                await fetch('/api/reset', { method: 'POST' });
-                showStatus('WiFi wird zurückgesetzt...', 'success');
-            }
-        }
+void WebServerManager::loop() {
+    pushStatus();
+    displayMirror.loop();
 
-        async function firmwareUpdate() {
-            if (confirm('Firmware-Update aus GitHub starten?')) {
-                showStatus('Starte Update...', 'success');
-                try {
-                    await fetch('/api/update', { method: 'POST' });
-                    showStatus('Update läuft, Gerät startet neu...', 'success');
-                } catch (e) {
-                    showStatus('Update fehlgeschlagen!', 'error');
-                }
-            }
-        }
-        
-        function showStatus(msg, type) {
-            const status = document.getElementById('status');
-            status.className = 'status ' + type;
-            status.textContent = msg;
-            setTimeout(() => status.style.display = 'none', 3000);
-        }
-    </script>
-</body>
-</html>
-)rawliteral";
-    
-    return html;
+    uint8_t actions = pending.load();
+    if (actions == ACTION_NONE) return;
+
+    // Neue Stadt: erst übernehmen, wenn kein Abruf mehr läuft
+    if ((actions & ACTION_WEATHER) && !weatherManager.isUpdating()) {
+        pending.fetch_and((uint8_t)~ACTION_WEATHER);
+        weatherManager.setCity(settingsManager.getCity());
+        weatherManager.updateAsync();
+    }
+
+    if (!(actions & (ACTION_RESTART | ACTION_RESET))) return;
+    if ((long)(millis() - actionDueAt) < 0) return;
+    pending.fetch_and((uint8_t)~(ACTION_RESTART | ACTION_RESET));
+
+    if (actions & ACTION_RESET) {
+        settingsManager.flush();
+        wifiConnection.reset();
+    }
+    if (actions & ACTION_RESTART) {
+        settingsManager.flush();
+        metricHistory.flush();
+        logger.flush();
+        ESP.restart();
+    }
 }
 
-void WebServerManager::handleRoot() {
-    server.send(200, "text/html", getHTML());
+// ------------------------------------------------------
+// 🔴 Live-Status über WebSocket
+// ------------------------------------------------------
+void WebServerManager::onWsEvent(AsyncWebSocket *socket, AsyncWebSocketClient *client, AwsEventType type) {
+    if (type == WS_EVT_CONNECT) {
+        LOG_DEBUG(Web, "WebSocket-Client #%u verbunden (%u aktiv)", client->id(), (unsigned)socket->count());
+        // Snapshot schickt der Haupt-Task, damit es nur einen Serialisierungspfad gibt
+        wsResync.store(true);
+    } else if (type == WS_EVT_DISCONNECT) {
+        LOG_DEBUG(Web, "WebSocket-Client #%u getrennt", client->id());
+    }
 }
 
-void WebServerManager::handleGetSettings() {
-    String json = "{";
-    json += "\"brightness\":" + String(settingsManager.getBrightness()) + ",";
-    json += "\"mode\":" + String(settingsManager.getDisplayMode()) + ",";
-    json += "\"city\":\"" + settingsManager.getCity() + "\"";
-    json += "}";
-    
-    server.send(200, "application/json", json);
+WebServerManager::LiveStatus WebServerManager::captureLiveStatus() {
+    LiveStatus s;
+    s.hour = timeManager.getHour();
+    s.minute = timeManager.getMinute();
+    s.second = timeManager.getSecond();
+    s.rssi = (int8_t)constrain(wifiConnection.getRSSI(), -128, 0);
+    s.mode = settingsManager.getDisplayMode();
+    s.brightness = settingsManager.getBrightness();
+    s.tempTenths = (int16_t)lroundf(weatherManager.getTemperature() * 10.0f);
+    s.condition = (uint8_t)weatherManager.getCondition();
+    return s;
 }
 
-void WebServerManager::handleSaveSettings() {
-    if (server.hasArg("plain")) {
-        String body = server.arg("plain");
-        
-        JsonDocument doc;
-        DeserializationError err = deserializeJson(doc, body);
-        if (err) {
-            server.send(400, "application/json", "{\"status\":\"error\",\"message\":\"invalid json\"}");
-            return;
-        }
+// prev = nullptr → alle Felder, sonst nur die geänderten. 0 = nichts zu senden.
+size_t WebServerManager::serializeLiveStatus(const LiveStatus &cur, const LiveStatus *prev, char *out, size_t len) {
+    JsonWriter json(out, len);
+    json.beginObject();
+    bool changed = false;
+    if (!prev || cur.hour != prev->hour || cur.minute != prev->minute || cur.second != prev->second) {
+        char time[9];
+        snprintf(time, sizeof(time), "%02u:%02u:%02u", cur.hour, cur.minute, cur.second);
+        json.add("time", time);
+        changed = true;
+    }
+    if (!prev || cur.rssi != prev->rssi) { json.add("rssi", cur.rssi); changed = true; }
+    if (!prev || cur.mode != prev->mode) { json.add("mode", cur.mode); changed = true; }
+    if (!prev || cur.brightness != prev->brightness) { json.add("brightness", cur.brightness); changed = true; }
+    if (!prev || cur.tempTenths != prev->tempTenths) { json.add("temp", cur.tempTenths / 10.0f); changed = true; }
+    if (!prev || cur.condition != prev->condition) {
+        json.add("weather", weatherConditionName((WeatherCondition)cur.condition));
+        changed = true;
+    }
+    json.endObject();
 
-        if (doc["brightness"].is<int>()) {
-            int value = doc["brightness"].as<int>();
-            settingsManager.setBrightness(value);
-            display.setBrightness(value);
-        }
-        if (doc["mode"].is<int>()) {
-            int value = doc["mode"].as<int>();
-            settingsManager.setDisplayMode(value);
-        }
-        if (doc["city"].is<const char*>()) {
-            String value = String(doc["city"].as<const char*>());
-            if (value.length() > 0) {
-                settingsManager.setCity(value);
-                weatherManager.setCity(settingsManager.getCity());
-                // Sofort aktualisieren (ohne Haken-Animation)
-                weatherManager.update(true);
-            }
-        }
+    return (changed && json.ok()) ? json.length() : 0;
+}
 
-        server.send(200, "application/json", "{\"status\":\"ok\"}");
-    } else {
-        server.send(400, "application/json", "{\"status\":\"error\"}");
+void WebServerManager::pushStatus() {
+    if (millis() - lastWsCleanup >= 1000) {
+        lastWsCleanup = millis();
+        ws.cleanupClients();
     }
+    if (ws.count() == 0) return;
+    if (millis() - lastPush < WS_PUSH_INTERVAL_MS) return;
+    lastPush = millis();
+
+    LiveStatus cur = captureLiveStatus();
+    bool full = wsResync.exchange(false);
+
+    // Einmal serialisieren, an alle Clients verteilen (gemeinsamer Puffer)
+    char buf[160];
+    size_t len = serializeLiveStatus(cur, full ? nullptr : &lastPushed, buf, sizeof(buf));
+    lastPushed = cur;
+    if (len == 0) return;
+
+    ws.textAll(buf, len);
 }
 
-void WebServerManager::handleStatus() {
-    String json = "{";
-    json += "\"ssid\":\"" + wifiConnection.getSSID() + "\",";
-    json += "\"ip\":\"" + wifiConnection.getIP() + "\",";
-    json += "\"rssi\":" + String(wifiConnection.getRSSI()) + ",";
-    json += "\"time\":\"" + timeManager.getTimeString() + "\",";
-    json += "\"date\":\"" + timeManager.getDateString() + "\",";
-    json += "\"uptime\":" + String(millis() / 1000);
-    json += "}";
-    
-    server.send(200, "application/json", json);
+// ------------------------------------------------------
+// Handler-Laufzeit (nur AsyncTCP-Task schreibt/liest)
+// ------------------------------------------------------
+// Start eines Handlers: Zeit + (mit HEAP_PROBE) Allokationszähler
+static uint32_t beginRequest() {
+    heapProbeStart();
+    return micros();
 }
 
-void WebServerManager::handleRestart() {
-    server.send(200, "text/plain", "Restarting...");
-    delay(1000);
-    ESP.restart();
+void WebServerManager::recordLatency(HttpRoute route, uint32_t startUs) {
+    uint32_t allocations = heapProbeStop();
+    uint32_t elapsed = micros() - startUs;
+#ifdef HEAP_PROBE
+    metrics.observeHttpAllocations(route, allocations);
+    if (allocations) LOG_DEBUG(Web, "Route %u: %u Heap-Allokationen", (unsigned)route, allocations);
+#else
+    (void)allocations;
+#endif
+    metrics.observeHttp(route, elapsed);
+    latencies[latencyHead] = elapsed;
+    latencyHead = (latencyHead + 1) % HTTP_LATENCY_SAMPLES;
+    if (latencyCount < HTTP_LATENCY_SAMPLES) latencyCount++;
 }
 
-void WebServerManager::handleReset() {
-    server.send(200, "text/plain", "Resetting WiFi...");
-    delay(1000);
-    wifiConnection.reset();
+uint32_t WebServerManager::getLatencyPercentileUs(uint8_t percentile) const {
+    if (latencyCount == 0) return 0;
+    uint32_t sorted[HTTP_LATENCY_SAMPLES];
+    memcpy(sorted, latencies, latencyCount * sizeof(uint32_t));
+    std::sort(sorted, sorted + latencyCount);
+    size_t idx = ((size_t)latencyCount * percentile) / 100;
+    return sorted[min(idx, (size_t)latencyCount - 1)];
 }
 
-void WebServerManager::handleNotFound() {
-    if (!wifiConnection.isConnected()) {
-        server.sendHeader("Location", "/", true);
-        server.send(302, "text/plain", "");
+// Statische, beim Build gzip-komprimierte Seite (extra_scripts/build_web_assets.py):
+// aus LittleFS mit fingerprinted Assets oder eingebettet mit allem inline.
+// Dynamische Werte lädt die Seite selbst über /api/settings und /api/status.
+void WebServerManager::handleRoot(AsyncWebServerRequest *request) {
+    uint32_t t0 = beginRequest();
+    PROFILE_ZONE("http:/");
+    HEAP_PROBE_PAUSE();   // Antwort (Datei/Blob) baut komplett die Bibliothek
+    AsyncWebServerResponse *response;
+    const char *etag = fsAssets ? FS_INDEX_ETAG : WEB_UI_ETAG;
+
+    if (request->hasHeader("If-None-Match") && request->getHeader("If-None-Match")->value() == etag) {
+        response = request->beginResponse(304);
+    } else if (fsAssets) {
+        // findet /index.html.gz und setzt Content-Encoding selbst
+        response = request->beginResponse(LittleFS, "/index.html", "text/html");
     } else {
-        server.send(404, "text/plain", "404: Seite nicht gefunden");
+        response = request->beginResponse(200, "text/html", WEB_UI_GZ, WEB_UI_GZ_LEN);
+        response->addHeader("Content-Encoding", "gzip");
     }
+    response->addHeader("ETag", etag);
+    response->addHeader("Cache-Control", "no-cache");
+    request->send(response);
+    recordLatency(HttpRoute::Root, t0);
 }
 
-void WebServerManager::handleOTAUpdate() {
-    Serial.println("[OTA] Firmware-Update angefordert (Web API)");
-    server.send(200, "text/plain", "Starte Firmware-Update...");
-
-    display.clear();
-    display.drawText2x2("UPDT");
-    display.update();
-
-    // Versionscheck
-    HTTPClient http;
-    http.setFollowRedirects(HTTPC_STRICT_FOLLOW_REDIRECTS);
-    http.begin(OTA_VERSION_URL);
-    int code = http.GET();
-
-    if (code != 200) {
-        Serial.printf("[OTA] Fehler beim Abruf der Version (%d)\n", code);
-        display.clear();
-        display.drawText2x2("ERR");
-        display.update();
-        delay(1500);
-        http.end();
+// ------------------------------------------------------
+// JSON-Antworten: ein Schema pro Endpunkt, serialisiert mit JsonWriter
+// in einen Stack-Puffer (keine String-Verkettung, korrektes Escaping)
+// ------------------------------------------------------
+static void sendJson(AsyncWebServerRequest *request, int code, const JsonWriter &json) {
+    HEAP_PROBE_PAUSE();   // Antwortobjekt der Bibliothek
+    if (!json.ok()) {
+        request->send(500, "application/json", "{\"status\":\"error\",\"message\":\"response too large\"}");
         return;
     }
+    request->send(code, "application/json", json.c_str());
+}
+
+// {"status":"ok"|"error","message":...}
+static void sendResult(AsyncWebServerRequest *request, int code, const char *message = nullptr) {
+    char buf[96];
+    JsonWriter json(buf, sizeof(buf));
+    json.beginObject().add("status", code < 400 ? "ok" : "error");
+    if (message) json.add("message", message);
+    json.endObject();
+    sendJson(request, code, json);
+}
+
+// ------------------------------------------------------
+// Große Antworten (History, Logs, Profil, Diagnose): ein statischer Puffer
+// statt malloc pro Anfrage. Die Bibliothek liest per Callback direkt daraus
+// nach, ohne Kopie in einen String; belegt bis zum letzten gesendeten Byte
+// bzw. Verbindungsabbruch, eine zweite Anfrage in der Zeit bekommt 503.
+// Nur AsyncTCP-Task (Handler und Callbacks), daher kein Lock nötig.
+// ------------------------------------------------------
+static char largeBuf[LARGE_RESPONSE_BUFFER];
+static size_t largeLen = 0;
+static uint32_t largeOwner = 0;     // 0 = frei, sonst Kennung der sendenden Anfrage
+static uint32_t largeLastOwner = 0;
+
+static char *acquireLargeBuffer(AsyncWebServerRequest *request) {
+    if (largeOwner != 0) {
+        sendResult(request, 503, "busy");
+        return nullptr;
+    }
+    if (++largeLastOwner == 0) largeLastOwner = 1;
+    largeOwner = largeLastOwner;
+    return largeBuf;
+}
+
+static void releaseLargeBuffer(uint32_t owner) {
+    if (largeOwner == owner) largeOwner = 0;
+}
 
-    String newVersion = http.getString();
-    newVersion.trim();
-    Serial.printf("[OTA] Online-Version: %s | Lokal: %s\n", newVersion.c_str(), CURRENT_VERSION);
-    http.end();
-
-    if (newVersion == CURRENT_VERSION) {
-        Serial.println("[OTA] Firmware ist aktuell.");
-        display.clear();
-        display.drawText2x2("OK");
-        display.update();
-        delay(1500);
+// Belegten Puffer (len Bytes) senden; ohne Inhalt sofort wieder freigeben
+static void sendLargeBuffer(AsyncWebServerRequest *request, const char *type, size_t len,
+                            const char *header = nullptr, const char *headerValue = nullptr) {
+    uint32_t owner = largeOwner;
+    if (len == 0) {
+        releaseLargeBuffer(owner);
+        sendResult(request, 500, "response too large");
         return;
     }
+    largeLen = len;
+    HEAP_PROBE_PAUSE();   // Antwortobjekt der Bibliothek
+    AsyncWebServerResponse *response = request->beginResponse(type, len, [owner](uint8_t *out, size_t max, size_t index) -> size_t {
+        if (largeOwner != owner || index >= largeLen) return 0;
+        size_t n = min(max, largeLen - index);
+        memcpy(out, largeBuf + index, n);
+        if (index + n >= largeLen) releaseLargeBuffer(owner);
+        return n;
+    });
+    if (header) response->addHeader(header, headerValue);
+    request->onDisconnect([owner]() { releaseLargeBuffer(owner); });
+    request->send(response);
+}
 
-    Serial.println("[OTA] Neue Version verfügbar! Starte Update...");
+// {"brightness":u8,"mode":u8,"city":str}
+void WebServerManager::handleGetSettings(AsyncWebServerRequest *request) {
+    uint32_t t0 = beginRequest();
+    PROFILE_ZONE("http:GET /api/settings");
+    Settings settings = settingsManager.snapshot();
 
-    // OTA mit HTTPClient + Update.writeStream()
-    WiFiClientSecure client;
-    client.setInsecure();  // HTTPS akzeptiert alle Zertifikate
+    char buf[128];
+    JsonWriter json(buf, sizeof(buf));
+    json.beginObject()
+        .add("brightness", settings.brightness)
+        .add("mode", settings.displayMode)
+        .add("city", settings.city)
+        .endObject();
 
-    HTTPClient httpUpdate;
-    httpUpdate.setFollowRedirects(HTTPC_STRICT_FOLLOW_REDIRECTS);
-    httpUpdate.begin(client, OTA_FIRMWARE_URL);
-    int httpCode = httpUpdate.GET();
+    sendJson(request, 200, json);
+    recordLatency(HttpRoute::GetSettings, t0);
+}
 
-    if (httpCode != 200) {
-        Serial.printf("[OTA] Fehler beim Firmware-Download (%d)\n", httpCode);
-        display.clear();
-        display.drawText2x2("ERR");
-        display.update();
-        delay(1500);
-        httpUpdate.end();
+void WebServerManager::handleSaveSettings(AsyncWebServerRequest *request, JsonVariant &json) {
+    uint32_t t0 = beginRequest();
+    PROFILE_ZONE("http:POST /api/settings");
+    if (!json.is<JsonObject>()) {
+        sendResult(request, 400, "invalid json");
+        recordLatency(HttpRoute::SaveSettings, t0);
         return;
     }
 
-    int len = httpUpdate.getSize();
-    if (!Update.begin(len)) {
-        Serial.println("[OTA] Nicht genug Speicher für Update!");
-        display.clear();
-        display.drawText2x2("ERR");
-        display.update();
-        delay(1500);
-        httpUpdate.end();
+    // Helligkeit übernimmt der Haupt-loop über die Settings-Version
+    if (json["brightness"].is<int>()) {
+        settingsManager.setBrightness(json["brightness"].as<int>());
+    }
+    if (json["mode"].is<int>()) {
+        settingsManager.setDisplayMode(json["mode"].as<int>());
+    }
+    // Zeigt in den Puffer des JSON-Dokuments, kein String
+    const char *city = json["city"].is<const char*>() ? json["city"].as<const char*>() : nullptr;
+    if (city && settingsManager.setCity(city)) {
+        // Sofort aktualisieren (ohne Haken-Animation), aber nicht im Handler
+        schedule(ACTION_WEATHER);
+    }
+
+    sendResult(request, 200);
+    recordLatency(HttpRoute::SaveSettings, t0);
+}
+
+// {"ssid":str,"ip":str,"rssi":i,"time":str,"date":str,"ntpOffsetMs":i,"sinceSync":i,
+//  "driftPpb":i,"frameSkewUs":u,"maxFrameSkewUs":u,"flashWrites":u,
+//  "httpP50Us":u,"httpP99Us":u,"ddpFps":u,"ddpFrames":u,"ddpDropped":u,"ddpSkipped":u,"uptime":u}
+void WebServerManager::handleStatus(AsyncWebServerRequest *request) {
+    uint32_t t0 = beginRequest();
+    PROFILE_ZONE("http:/api/status");
+    char ssid[33], ip[16], time[9], date[11];
+    wifiConnection.copySSID(ssid, sizeof(ssid));
+    wifiConnection.copyIP(ip, sizeof(ip));
+    snprintf(time, sizeof(time), "%02u:%02u:%02u", timeManager.getHour(), timeManager.getMinute(), timeManager.getSecond());
+    snprintf(date, sizeof(date), "%02u.%02u.%04u", timeManager.getDay(), timeManager.getMonth(), timeManager.getYear());
+
+    char buf[512];
+    JsonWriter json(buf, sizeof(buf));
+    json.beginObject()
+        .add("ssid", ssid)
+        .add("ip", ip)
+        .add("rssi", wifiConnection.getRSSI())
+        .add("time", time)
+        .add("date", date)
+        .add("ntpOffsetMs", timeManager.getSyncOffsetMs())
+        .add("sinceSync", timeManager.isSynced() ? (long)timeManager.getSecondsSinceSync() : -1L)
+        .add("driftPpb", timeManager.getDriftPpb())
+        .add("frameSkewUs", timeManager.getFrameSkewUs())
+        .add("maxFrameSkewUs", timeManager.getMaxFrameSkewUs())
+        .add("flashWrites", settingsManager.getFlashWrites())
+        .add("httpP50Us", getLatencyPercentileUs(50))
+        .add("httpP99Us", getLatencyPercentileUs(99))
+        .add("ddpFps", pixelReceiver.getFps())
+        .add("ddpFrames", pixelReceiver.getFrames())
+        .add("ddpDropped", pixelReceiver.getDropped())
+        .add("ddpSkipped", pixelReceiver.getSkipped())
+        .add("uptime", millis() / 1000)
+        .endObject();
+
+    sendJson(request, 200, json);
+    recordLatency(HttpRoute::Status, t0);
+}
+
+void WebServerManager::handleRestart(AsyncWebServerRequest *request) {
+    uint32_t t0 = beginRequest();
+    PROFILE_ZONE("http:/api/restart");
+    {
+        HEAP_PROBE_PAUSE();
+        request->send(200, "text/plain", "Restarting...");
+    }
+    schedule(ACTION_RESTART);
+    recordLatency(HttpRoute::Restart, t0);
+}
+
+void WebServerManager::handleReset(AsyncWebServerRequest *request) {
+    uint32_t t0 = beginRequest();
+    PROFILE_ZONE("http:/api/reset");
+    {
+        HEAP_PROBE_PAUSE();
+        request->send(200, "text/plain", "Resetting WiFi...");
+    }
+    schedule(ACTION_RESET);
+    recordLatency(HttpRoute::Reset, t0);
+}
+
+void WebServerManager::handleNotFound(AsyncWebServerRequest *request) {
+    if (!wifiConnection.isConnected()) {
+        request->redirect("/");
+    } else {
+        request->send(404, "text/plain", "404: Seite nicht gefunden");
+    }
+}
+
+void WebServerManager::handleOTAUpdate(AsyncWebServerRequest *request) {
+    uint32_t t0 = beginRequest();
+    PROFILE_ZONE("http:/api/update");
+    LOG_INFO(OTA, "Firmware-Update angefordert (Web API)");
+    // Läuft im OtaService-Task, Fortschritt über /api/update/status
+    if (otaService.start()) {
+        sendResult(request, 202);
+    } else {
+        sendResult(request, 409, "update already running");
+    }
+    recordLatency(HttpRoute::Update, t0);
+}
+
+// {"state":str,"downloaded":u,"total":u,"imageBytes":u,"percent":u,"compressed":bool,
+//  "durationMs":u,"version":str,"message":str,"pendingVerify":bool}
+void WebServerManager::handleOTAStatus(AsyncWebServerRequest *request) {
+    uint32_t t0 = beginRequest();
+    PROFILE_ZONE("http:/api/update/status");
+    OtaStatus status = otaService.getStatus();
+
+    char buf[256];
+    JsonWriter json(buf, sizeof(buf));
+    json.beginObject()
+        .add("state", OtaService::stateName(status.state))
+        .add("downloaded", status.downloaded)
+        .add("total", status.total)
+        .add("imageBytes", status.imageBytes)
+        .add("percent", otaService.getPercent())
+        .addBool("compressed", status.compressed)
+        .add("durationMs", status.durationMs)
+        .add("version", status.version)
+        .add("message", status.message)
+        .addBool("pendingVerify", otaService.isPendingVerify())
+        .endObject();
+
+    sendJson(request, 200, json);
+    recordLatency(HttpRoute::UpdateStatus, t0);
+}
+
+// Prometheus-Textformat (Formatierung direkt in den Antwortpuffer)
+void WebServerManager::handleMetrics(AsyncWebServerRequest *request) {
+    uint32_t t0 = beginRequest();
+    PROFILE_ZONE("http:/metrics");
+    HEAP_PROBE_PAUSE();   // formatiert direkt in den (wachsenden) Puffer der Bibliothek
+    AsyncResponseStream *response = request->beginResponseStream("text/plain; version=0.0.4");
+    metrics.writePrometheus(*response);
+    request->send(response);
+    recordLatency(HttpRoute::Metrics, t0);
+}
+
+// ?tier=minute|hour|day, Schema siehe MetricHistory::serialize().
+// Zu groß für den AsyncTCP-Stack → gemeinsamer statischer Antwortpuffer.
+void WebServerManager::handleHistory(AsyncWebServerRequest *request) {
+    uint32_t t0 = beginRequest();
+    PROFILE_ZONE("http:/api/history");
+    HistoryTier tier = HistoryTier::Minute;
+    if (request->hasParam("tier") && !MetricHistory::parseTier(request->getParam("tier")->value().c_str(), tier)) {
+        sendResult(request, 400, "unknown tier");
+        recordLatency(HttpRoute::History, t0);
         return;
     }
 
-    WiFiClient *stream = httpUpdate.getStreamPtr();
-    size_t written = Update.writeStream(*stream);
+    char *buf = acquireLargeBuffer(request);
+    if (buf) sendLargeBuffer(request, "application/json", metricHistory.serialize(tier, buf, HISTORY_JSON_BUFFER));
+    recordLatency(HttpRoute::History, t0);
+}
 
-    if (Update.end() && Update.isFinished()) {
-        Serial.printf("[OTA] Update erfolgreich (%d Bytes)\n", written);
-        display.clear();
-        display.animateCheckmark();
-        display.update();
-        delay(1500);
-        ESP.restart();
+// ?since=<seq> → nur neuere Einträge (für inkrementelles Nachladen)
+// {"next":u,"more":bool,"dropped":u,"levels":{module:level,...},
+//  "entries":[{"seq":u,"ms":u,"level":str,"module":str,"msg":str},...]}
+// "more":true → Puffer voll, Rest mit ?since=<next> abholen
+void WebServerManager::handleLogs(AsyncWebServerRequest *request) {
+    uint32_t t0 = beginRequest();
+    PROFILE_ZONE("http:/api/logs");
+    uint32_t since = request->hasParam("since") ? request->getParam("since")->value().toInt() : 0;
+
+    char *buf = acquireLargeBuffer(request);
+    if (!buf) {
+        recordLatency(HttpRoute::Logs, t0);
+        return;
+    }
+
+    JsonWriter json(buf, LOGS_JSON_BUFFER);
+    json.beginObject();
+    json.beginObject("levels");
+    for (uint8_t i = 0; i < (uint8_t)LogModule::COUNT; ++i) {
+        json.add(Logger::moduleName((LogModule)i), Logger::levelName(logger.getLevel((LogModule)i)));
+    }
+    json.endObject();
+    json.add("dropped", logger.getDropped());
+
+    // Formatierung hier statt im Logger: Historie bleibt binär und klein
+    json.beginArray("entries");
+    LogRecord record;
+    char msg[LOG_LINE_LEN];
+    bool more = false;
+    while (logger.copyRecent(since, record)) {
+        if (LOGS_JSON_BUFFER - json.length() < LOGS_ENTRY_RESERVE) {
+            more = true;
+            break;
+        }
+        since = record.seq + 1;
+        Logger::format(record, msg, sizeof(msg));
+        json.beginObject()
+            .add("seq", record.seq)
+            .add("ms", record.ms)
+            .add("level", Logger::levelName(record.level))
+            .add("module", Logger::moduleName(record.module))
+            .add("msg", msg)
+            .endObject();
+    }
+    json.endArray();
+    json.add("next", since);
+    json.addBool("more", more);
+    json.endObject();
+
+    sendLargeBuffer(request, "application/json", json.ok() ? json.length() : 0);
+    recordLatency(HttpRoute::Logs, t0);
+}
+
+// {"module":str|"*","level":"debug"|"info"|"warn"|"error"|"off"}
+void WebServerManager::handleLogLevel(AsyncWebServerRequest *request, JsonVariant &json) {
+    uint32_t t0 = beginRequest();
+    PROFILE_ZONE("http:/api/logs/level");
+    LogLevel level;
+    const char *moduleName = json["module"] | "*";
+    if (!json["level"].is<const char*>() || !Logger::parseLevel(json["level"].as<const char*>(), level)) {
+        sendResult(request, 400, "unknown level");
+    } else if (strcmp(moduleName, "*") == 0) {
+        logger.setLevelAll(level);
+        sendResult(request, 200);
     } else {
-        Serial.println("[OTA] Fehler beim Schreiben der Firmware!");
-        display.clear();
-        display.drawText2x2("ERR");
-        display.update();
-        delay(1500);
+        LogModule module;
+        if (Logger::parseModule(moduleName, module)) {
+            logger.setLevel(module, level);
+            sendResult(request, 200);
+        } else {
+            sendResult(request, 400, "unknown module");
+        }
     }
+    recordLatency(HttpRoute::SetLogLevel, t0);
+}
+
+// Folded Stacks ("task;zone;zone zyklen"), direkt für flamegraph.pl / speedscope.
+// ?reset=1 nullt die Zähler nach dem Export (Messfenster neu starten).
+void WebServerManager::handleProfile(AsyncWebServerRequest *request) {
+    uint32_t t0 = beginRequest();
+#ifdef PROFILING
+    char *buf = acquireLargeBuffer(request);
+    if (buf) {
+        size_t len = profiler.writeFolded(buf, PROFILE_TEXT_BUFFER);
+        if (request->hasParam("reset") && request->getParam("reset")->value() == "1") profiler.reset();
+        char overflows[12];
+        snprintf(overflows, sizeof(overflows), "%u", (unsigned)profiler.getOverflows());
+        sendLargeBuffer(request, "text/plain", len, "X-Profile-Overflows", overflows);
+    }
+#else
+    sendResult(request, 501, "built without -D PROFILING");
+#endif
+    recordLatency(HttpRoute::Profile, t0);
+}
 
-    httpUpdate.end();
+// Reset-Grund, Hänger je Abschnitt und Flugschreiber (auch frühere Starts),
+// Schema siehe Diagnostics::serialize()
+void WebServerManager::handleDiagnostics(AsyncWebServerRequest *request) {
+    uint32_t t0 = beginRequest();
+    PROFILE_ZONE("http:/api/diagnostics");
+    char *buf = acquireLargeBuffer(request);
+    if (buf) sendLargeBuffer(request, "application/json", diagnostics.serialize(buf, DIAG_JSON_BUFFER));
+    recordLatency(HttpRoute::Diagnostics, t0);
 }
@@ -2,7 +2,9 @@
 #include "config.h"
 #include "display.h"
 #include "version.h"
+#include "logger.h"
 #include <ESPmDNS.h>
+#include <esp_wifi.h>
 
 WiFiConnectionManager wifiConnection;
 
@@ -23,7 +25,7 @@ void WiFiConnectionManager::onConfigMode(WiFiManager *manager) {
 }
 
 bool WiFiConnectionManager::begin() {
-    Serial.println("Starte WiFi-Verbindung...");
+    LOG_INFO(WiFi, "Starte WiFi-Verbindung...");
     
     // WiFiManager Konfiguration
     wifiManager.setConfigPortalTimeout(180); // 3 Minuten
@@ -60,15 +62,15 @@ bool WiFiConnectionManager::begin() {
         String mdnsName = String(WiFi.getHostname());
         mdnsName.toLowerCase();
         if (!MDNS.begin(mdnsName.c_str())) {
-            Serial.println("[mDNS] Start fehlgeschlagen");
+            LOG_WARN(WiFi, "Start fehlgeschlagen");
         } else {
             MDNS.addService("http", "tcp", WEB_SERVER_PORT);
             MDNS.addServiceTxt("http", "tcp", "id", "obegraensad-x");
             MDNS.addServiceTxt("http", "tcp", "ver", CURRENT_VERSION);
-            Serial.println("[mDNS] Aktiv: http://" + mdnsName + ".local");
+            LOG_INFO(WiFi, "mDNS aktiv: http://%s.local", mdnsName);
         }
     } else {
-        Serial.println("WiFi-Verbindung fehlgeschlagen!");
+        LOG_ERROR(WiFi, "WiFi-Verbindung fehlgeschlagen!");
     }
     
     return connected;
@@ -86,6 +88,24 @@ String WiFiConnectionManager::getIP() {
     return WiFi.localIP().toString();
 }
 
+size_t WiFiConnectionManager::copySSID(char *out, size_t len) {
+    if (len == 0) return 0;
+    wifi_ap_record_t info;
+    if (esp_wifi_sta_get_ap_info(&info) != ESP_OK) {
+        out[0] = '\0';
+        return 0;
+    }
+    strncpy(out, (const char *)info.ssid, len - 1);
+    out[len - 1] = '\0';
+    return strlen(out);
+}
+
+size_t WiFiConnectionManager::copyIP(char *out, size_t len) {
+    IPAddress ip = WiFi.localIP();
+    int n = snprintf(out, len, "%u.%u.%u.%u", ip[0], ip[1], ip[2], ip[3]);
+    return n > 0 ? (size_t)n : 0;
+}
+
 int WiFiConnectionManager::getRSSI() {
     return WiFi.RSSI();
 }
@@ -0,0 +1,266 @@
+// Seite ist statisch (gzip + ETag) → Werte über die API nachladen
+async function loadSettings() {
+    try {
+        const response = await fetch('/api/settings');
+        const data = await response.json();
+        document.getElementById('brightness').value = data.brightness;
+        updateValue(data.brightness);
+        document.getElementById('mode').value = String(data.mode);
+        document.getElementById('city').value = data.city;
+    } catch (error) {
+        console.error('Settings load failed:', error);
+    }
+}
+
+async function loadStatus() {
+    try {
+        const response = await fetch('/api/status');
+        const data = await response.json();
+        document.getElementById('ssid').textContent = data.ssid;
+        document.getElementById('ip').textContent = data.ip;
+        applyLive(data);
+    } catch (error) {
+        console.error('Status update failed:', error);
+    }
+}
+
+// Live-Werte (WebSocket-Deltas oder /api/status)
+const live = {};
+function applyLive(delta) {
+    Object.assign(live, delta);
+    if (delta.time !== undefined) document.getElementById('time').textContent = live.time;
+    if (delta.rssi !== undefined) document.getElementById('rssi').textContent = live.rssi + ' dBm';
+    if (delta.temp !== undefined || delta.weather !== undefined) {
+        document.getElementById('weather').textContent =
+            (live.temp !== undefined ? live.temp.toFixed(1) + ' °C' : '–') +
+            (live.weather ? ' · ' + live.weather : '');
+    }
+    // Formularfelder nicht überschreiben, während sie bearbeitet werden
+    const brightness = document.getElementById('brightness');
+    if (delta.brightness !== undefined && document.activeElement !== brightness) {
+        brightness.value = live.brightness;
+        updateValue(live.brightness);
+    }
+    const mode = document.getElementById('mode');
+    if (delta.mode !== undefined && document.activeElement !== mode) {
+        mode.value = String(live.mode);
+    }
+}
+
+// Server pusht nur Änderungen; ohne Verbindung auf Polling zurückfallen
+let pollTimer = null;
+function connectLive() {
+    const socket = new WebSocket(`ws://${location.host}/ws`);
+    socket.onopen = () => {
+        clearInterval(pollTimer);
+        pollTimer = null;
+    };
+    socket.onmessage = (event) => applyLive(JSON.parse(event.data));
+    socket.onclose = () => {
+        if (!pollTimer) pollTimer = setInterval(loadStatus, 1000);
+        setTimeout(connectLive, 3000);
+    };
+}
+
+// Panel-Vorschau: 'K' + 32 Byte (Keyframe) oder 'D' + 4 Byte Maske + geänderte Bytes
+const frame = new Uint8Array(32);
+function drawPreview() {
+    const ctx = document.getElementById('preview').getContext('2d');
+    ctx.fillStyle = '#111';
+    ctx.fillRect(0, 0, 160, 160);
+    ctx.fillStyle = '#ffe9b0';
+    for (let y = 0; y < 16; y++) {
+        const row = (frame[y * 2] << 8) | frame[y * 2 + 1];
+        for (let x = 0; x < 16; x++) {
+            if (row & (0x8000 >> x)) ctx.fillRect(x * 10 + 1, y * 10 + 1, 8, 8);
+        }
+    }
+}
+function connectPreview() {
+    const socket = new WebSocket(`ws://${location.host}/ws/display`);
+    socket.binaryType = 'arraybuffer';
+    socket.onmessage = (event) => {
+        const msg = new Uint8Array(event.data);
+        if (msg[0] === 0x4B) {
+            frame.set(msg.subarray(1, 33));
+        } else if (msg[0] === 0x44) {
+            const mask = ((msg[1] << 24) | (msg[2] << 16) | (msg[3] << 8) | msg[4]) >>> 0;
+            let p = 5;
+            for (let i = 0; i < 32; i++) {
+                if (mask & (1 << i)) frame[i] = msg[p++];
+            }
+        }
+        drawPreview();
+    };
+    socket.onclose = () => setTimeout(connectPreview, 3000);
+}
+
+// Verlauf (/api/history): Band = Min..Max, Linie = Mittelwert
+const HISTORY_UNITS = { heap: ' B', largest: ' B', loop: ' µs', rssi: ' dBm', frame: ' µs' };
+let history = null;
+async function loadHistory() {
+    try {
+        const tier = document.getElementById('historyTier').value;
+        const response = await fetch('/api/history?tier=' + tier);
+        history = await response.json();
+        drawHistory();
+    } catch (error) {
+        console.error('History load failed:', error);
+    }
+}
+function drawHistory() {
+    const canvas = document.getElementById('historyChart');
+    const ctx = canvas.getContext('2d');
+    const legend = document.getElementById('historyLegend');
+    ctx.clearRect(0, 0, canvas.width, canvas.height);
+    if (!history || history.points.length === 0) {
+        legend.textContent = 'Noch keine Daten';
+        return;
+    }
+
+    // Zeile: [Zeit, min0, avg0, max0, min1, ...]; null = keine Stichprobe im Intervall
+    const name = document.getElementById('historySeries').value;
+    const col = 1 + history.series.indexOf(name) * 3;
+    const points = history.points;
+    let lo = Infinity, hi = -Infinity, last = null;
+    for (const p of points) {
+        if (p[col] === null) continue;
+        lo = Math.min(lo, p[col]);
+        hi = Math.max(hi, p[col + 2]);
+        last = p;
+    }
+    if (last === null) {
+        legend.textContent = 'Keine Daten für diese Reihe';
+        return;
+    }
+    const span = hi > lo ? hi - lo : 1;
+
+    const w = canvas.width, h = canvas.height, pad = 6;
+    const x = (i) => points.length === 1 ? w / 2 : pad + i * (w - 2 * pad) / (points.length - 1);
+    const y = (v) => h - pad - (v - lo) * (h - 2 * pad) / span;
+
+    // Zusammenhängende Abschnitte ohne Lücke einzeln zeichnen
+    const runs = [];
+    points.forEach((p, i) => {
+        if (p[col] === null) return;
+        if (i === 0 || points[i - 1][col] === null) runs.push([]);
+        runs[runs.length - 1].push(i);
+    });
+
+    ctx.fillStyle = 'rgba(102, 126, 234, 0.25)';
+    ctx.strokeStyle = '#667eea';
+    ctx.lineWidth = 2;
+    for (const run of runs) {
+        ctx.beginPath();
+        run.forEach((i) => ctx.lineTo(x(i), y(points[i][col + 2])));
+        for (let k = run.length - 1; k >= 0; k--) ctx.lineTo(x(run[k]), y(points[run[k]][col]));
+        ctx.fill();
+
+        ctx.beginPath();
+        run.forEach((i) => ctx.lineTo(x(i), y(points[i][col + 1])));
+        ctx.stroke();
+    }
+
+    const unit = HISTORY_UNITS[name] || '';
+    legend.textContent = `aktuell ${last[col + 1]}${unit} · min ${lo}${unit} · max ${hi}${unit}`;
+}
+
+loadSettings();
+loadStatus();
+connectLive();
+drawPreview();
+connectPreview();
+loadHistory();
+setInterval(loadHistory, 60000);
+
+function updateValue(val) {
+    document.getElementById('brightnessValue').textContent = val;
+}
+
+document.getElementById('settingsForm').addEventListener('submit', async (e) => {
+    e.preventDefault();
+    const data = {
+        brightness: parseInt(document.getElementById('brightness').value),
+        mode: parseInt(document.getElementById('mode').value),
+        city: (document.getElementById('city').value || '').trim()
+    };
+
+    try {
+        const response = await fetch('/api/settings', {
+            method: 'POST',
+            headers: { 'Content-Type': 'application/json' },
+            body: JSON.stringify(data)
+        });
+        if (response.ok) {
+            showStatus('Einstellungen gespeichert!', 'success');
+        } else {
+            showStatus('Fehler beim Speichern!', 'error');
+        }
+    } catch (error) {
+        showStatus('Fehler beim Speichern!', 'error');
+    }
+});
+
+async function restart() {
+    if (confirm('Gerät neu starten?')) {
+        await fetch('/api/restart', { method: 'POST' });
+        showStatus('Neustart...', 'success');
+    }
+}
+
+async function resetWiFi() {
+    if (confirm('WiFi-Einstellungen zurücksetzen? Das Gerät startet neu.')) {
+        await fetch('/api/reset', { method: 'POST' });
+        showStatus('WiFi wird zurückgesetzt...', 'success');
+    }
+}
+
+async function firmwareUpdate() {
+    if (confirm('Firmware-Update aus GitHub starten?')) {
+        try {
+            const response = await fetch('/api/update', { method: 'POST' });
+            if (!response.ok) {
+                showStatus('Update läuft bereits', 'error');
+                return;
+            }
+            pollUpdate();
+        } catch (e) {
+            showStatus('Update fehlgeschlagen!', 'error');
+        }
+    }
+}
+
+// Fortschritt des OTA-Tasks abfragen, bis ein Endzustand erreicht ist
+async function pollUpdate() {
+    try {
+        const response = await fetch('/api/update/status');
+        const data = await response.json();
+        if (data.state === 'downloading' || data.state === 'verifying') {
+            showStatus(`Update ${data.version}: ${data.percent}%`, 'success');
+        } else if (data.state === 'checking') {
+            showStatus('Prüfe Version...', 'success');
+        } else if (data.state === 'uptodate') {
+            showStatus('Firmware ist aktuell', 'success');
+            return;
+        } else if (data.state === 'success') {
+            showStatus(`Update installiert (${data.downloaded} B${data.compressed ? ' gzip' : ''}, ${(data.durationMs / 1000).toFixed(1)} s), Neustart...`, 'success');
+            return;
+        } else if (data.state === 'failed') {
+            showStatus('Update fehlgeschlagen: ' + data.message, 'error');
+            return;
+        }
+    } catch (e) {
+        // Gerät startet evtl. gerade neu
+    }
+    setTimeout(pollUpdate, 1000);
+}
+
+let statusTimer = null;
+function showStatus(msg, type) {
+    const status = document.getElementById('status');
+    status.className = 'status ' + type;
+    status.textContent = msg;
+    status.style.display = '';
+    clearTimeout(statusTimer);
+    statusTimer = setTimeout(() => status.style.display = 'none', 3000);
+}